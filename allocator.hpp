@@ -0,0 +1,114 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           allocator.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file contains the definition of the metafunctions that inspect the allocator of a
+ *                container and rebind a container to another allocator.
+ *
+ **************************************************************************************************************/
+
+#ifndef __ALLOCATOR_H__
+#define __ALLOCATOR_H__
+
+#include "type_detector.hpp"
+
+namespace traits
+{
+    /******************************************************************************
+     * Metafunction: allocator_of
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the allocator type of a container (its nested allocator_type).
+     *   -If the type has no allocator, it has no type member, so it can be used with SFINAE.
+     *
+     * Template Parameters:
+     *   -C : The container type.
+     *
+     *****************************************************************************/
+    template<typename C>
+    using member_allocator_type = typename C::allocator_type;
+
+    template<typename C , typename = void>
+    struct allocator_of{};
+
+    template<typename C>
+    struct allocator_of<C , void_t<member_allocator_type<C>>> : type_is<member_allocator_type<C>>{};
+
+    template<typename C>
+    using allocator_of_t = typename allocator_of<C>::type;
+
+    /******************************************************************************
+     * Metafunction: is_allocator_aware
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns true if a type is a container that takes its memory from an allocator.
+     *
+     * Template Parameters:
+     *   -C : The type to check.
+     *
+     *****************************************************************************/
+    template<typename C>
+    struct is_allocator_aware : And<is_container_v<C> , is_detected_v<member_allocator_type , C>>{};
+
+    template<typename C>
+    static constexpr bool is_allocator_aware_v = is_allocator_aware<C>::value;
+
+    /******************************************************************************
+     * Metafunction: rebind_alloc
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the allocator of the same family as A that allocates U.
+     *   -The allocator must be a template whose first parameter is its value type
+     *    (Alloc<T, Rest...>), as std::allocator and arena_allocator are.
+     *
+     * Template Parameters:
+     *   -A : The allocator type.
+     *   -U : The new value type.
+     *
+     *****************************************************************************/
+    template<typename A , typename U>
+    struct rebind_alloc;
+
+    template<template<typename...> class A , typename T , typename ...Rest , typename U>
+    struct rebind_alloc<A<T , Rest...> , U> : type_is<A<U , Rest...>>{};
+
+    template<typename A , typename U>
+    using rebind_alloc_t = typename rebind_alloc<A , U>::type;
+
+    /******************************************************************************
+     * Metafunction: rebind_container
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the same container type using another allocator family.
+     *   -The template argument equal to the current allocator is replaced by NewAlloc rebound to
+     *    the value type of the current allocator, so NewAlloc's own value type does not matter
+     *    (maps get an allocator of pair<const Key, T>, not of T).
+     *
+     * Template Parameters:
+     *   -C        : The allocator aware container type (std::vector<int>, std::map<int, int>, ...).
+     *   -NewAlloc : The new allocator, with any value type.
+     *
+     *****************************************************************************/
+    template<typename C , typename NewAlloc>
+    struct rebind_container;
+
+    template<template<typename...> class C , typename ...Args , typename NewAlloc>
+    struct rebind_container<C<Args...> , NewAlloc>
+    {
+        static_assert(is_allocator_aware_v<C<Args...>> , "rebind_container needs an allocator aware container");
+
+        using old_allocator = allocator_of_t<C<Args...>>;
+
+        using new_allocator = rebind_alloc_t<NewAlloc , value_type_t<old_allocator>>;
+
+        using type = C<if_type_t<is_same_v<Args , old_allocator> , new_allocator , Args>...>;
+    };
+
+    template<typename C , typename NewAlloc>
+    using rebind_container_t = typename rebind_container<C , NewAlloc>::type;
+
+}
+
+#endif // __ALLOCATOR_H__
@@ -0,0 +1,306 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           arena.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file contains the definition of a monotonic arena, of a pool arena built on it and of
+ *                the allocator that lets standard containers take their memory from either of them.
+ *                Any allocator aware container can be moved onto an arena with arena_container_t.
+ *
+ **************************************************************************************************************/
+
+#ifndef __ARENA_H__
+#define __ARENA_H__
+
+#include <cstdint>
+#include <new>
+
+#include "allocator.hpp"
+
+namespace traits
+{
+    /******************************************************************************
+     * Class: monotonic_arena
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This class hands out memory by bumping a pointer inside a chunk, and never reuses it.
+     *   -When a chunk is exhausted a new one, twice as big as the previous one, is taken from
+     *    operator new. All the chunks are freed at once by release or by the destructor.
+     *   -It can start with a caller provided buffer (a stack array, for instance), which is used
+     *    before any chunk is allocated and is never freed by the arena.
+     *   -It is not thread safe, and it must outlive every allocation taken from it.
+     *
+     *****************************************************************************/
+    class monotonic_arena
+    {
+    public:
+        static constexpr size_t default_chunk_size = 4096;
+
+        explicit monotonic_arena(size_t initial_chunk_size = default_chunk_size) noexcept
+            : next_chunk_size_(initial_chunk_size == 0 ? default_chunk_size : initial_chunk_size)
+        {
+        }
+
+        monotonic_arena(void *buffer , size_t size) noexcept
+            : buffer_(static_cast<unsigned char *>(buffer)) , buffer_size_(size) ,
+              current_(buffer_) , remaining_(size) ,
+              next_chunk_size_(size == 0 ? default_chunk_size : size * 2)
+        {
+        }
+
+        monotonic_arena(const monotonic_arena &) = delete;
+        monotonic_arena &operator=(const monotonic_arena &) = delete;
+
+        ~monotonic_arena()
+        {
+            release();
+        }
+
+        void *allocate(size_t bytes , size_t alignment)
+        {
+            void *result = bump(bytes , alignment);
+            if(result == nullptr)
+            {
+                grow(bytes + alignment);
+                result = bump(bytes , alignment);
+            }
+            return result;
+        }
+
+        /* Description:
+         * Memory is only given back by release, so this does nothing.
+         */
+        void deallocate(void * , size_t , size_t) noexcept
+        {
+        }
+
+        /* Description:
+         * Frees every chunk and starts again from the initial buffer, if any.
+         */
+        void release() noexcept
+        {
+            while(chunks_ != nullptr)
+            {
+                chunk_header *next = chunks_->next;
+                ::operator delete(chunks_);
+                chunks_ = next;
+            }
+            current_ = buffer_;
+            remaining_ = buffer_size_;
+        }
+
+    private:
+        struct chunk_header
+        {
+            chunk_header *next;
+        };
+
+        void *bump(size_t bytes , size_t alignment) noexcept
+        {
+            const size_t padding = static_cast<size_t>(-reinterpret_cast<uintptr_t>(current_) & (alignment - 1));
+            if(current_ == nullptr || padding > remaining_ || bytes > remaining_ - padding)
+            {
+                return nullptr;
+            }
+
+            void *result = current_ + padding;
+            current_ += padding + bytes;
+            remaining_ -= padding + bytes;
+            return result;
+        }
+
+        void grow(size_t minimum)
+        {
+            size_t size = next_chunk_size_;
+            while(size < minimum + sizeof(chunk_header))
+            {
+                size *= 2;
+            }
+
+            chunk_header *chunk = static_cast<chunk_header *>(::operator new(size));
+            chunk->next = chunks_;
+            chunks_ = chunk;
+
+            current_ = reinterpret_cast<unsigned char *>(chunk + 1);
+            remaining_ = size - sizeof(chunk_header);
+            next_chunk_size_ = size * 2;
+        }
+
+        unsigned char *buffer_ = nullptr;
+        size_t buffer_size_ = 0;
+        unsigned char *current_ = nullptr;
+        size_t remaining_ = 0;
+        size_t next_chunk_size_;
+        chunk_header *chunks_ = nullptr;
+    };
+
+    /******************************************************************************
+     * Class: pool_arena
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This class adds free lists to a monotonic arena, so freed blocks are reused.
+     *   -Requests up to max_block_size bytes are rounded up to a power of two size class,
+     *    one free list per class. It suits node based containers (map, set, list, ...) that
+     *    allocate and free many blocks of the same size.
+     *   -Bigger or over-aligned requests are served by the monotonic arena and not reused.
+     *   -It is not thread safe, and it must outlive every allocation taken from it.
+     *
+     *****************************************************************************/
+    class pool_arena
+    {
+    public:
+        static constexpr size_t min_block_size = alignof(std::max_align_t);
+
+        static constexpr size_t class_count = 7;
+
+        static constexpr size_t max_block_size = min_block_size << (class_count - 1);
+
+        explicit pool_arena(size_t initial_chunk_size = monotonic_arena::default_chunk_size) noexcept
+            : upstream_(initial_chunk_size)
+        {
+        }
+
+        pool_arena(void *buffer , size_t size) noexcept : upstream_(buffer , size)
+        {
+        }
+
+        void *allocate(size_t bytes , size_t alignment)
+        {
+            if(!is_pooled(bytes , alignment))
+            {
+                return upstream_.allocate(bytes , alignment);
+            }
+
+            const size_t index = class_index(bytes);
+            if(free_[index] != nullptr)
+            {
+                free_block *block = free_[index];
+                free_[index] = block->next;
+                return block;
+            }
+            return upstream_.allocate(min_block_size << index , min_block_size);
+        }
+
+        void deallocate(void *pointer , size_t bytes , size_t alignment) noexcept
+        {
+            if(is_pooled(bytes , alignment))
+            {
+                const size_t index = class_index(bytes);
+                free_[index] = ::new(pointer) free_block{free_[index]};
+            }
+        }
+
+        /* Description:
+         * Frees every block at once, including the blocks still in use.
+         */
+        void release() noexcept
+        {
+            upstream_.release();
+            for(free_block *&list : free_)
+            {
+                list = nullptr;
+            }
+        }
+
+    private:
+        struct free_block
+        {
+            free_block *next;
+        };
+
+        static constexpr bool is_pooled(size_t bytes , size_t alignment) noexcept
+        {
+            return bytes <= max_block_size && alignment <= min_block_size;
+        }
+
+        static constexpr size_t class_index(size_t bytes) noexcept
+        {
+            size_t index = 0;
+            while((min_block_size << index) < bytes)
+            {
+                ++index;
+            }
+            return index;
+        }
+
+        monotonic_arena upstream_;
+        free_block *free_[class_count] = {};
+    };
+
+    /******************************************************************************
+     * Class: arena_allocator
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This class is a standard allocator that forwards to an arena.
+     *   -It is implicitly constructible from the arena, so a container can be built
+     *    with the arena alone: std::vector<int, arena_allocator<int>> v(arena);
+     *   -Two allocators are equal if they use the same arena.
+     *
+     * Template Parameters:
+     *   -T     : The type to allocate.
+     *   -Arena : The arena type, monotonic_arena or pool_arena.
+     *
+     *****************************************************************************/
+    template<typename T , typename Arena = monotonic_arena>
+    class arena_allocator
+    {
+    public:
+        using value_type = T;
+
+        arena_allocator(Arena &arena) noexcept : arena_(&arena)
+        {
+        }
+
+        template<typename U>
+        arena_allocator(const arena_allocator<U , Arena> &other) noexcept : arena_(other.arena())
+        {
+        }
+
+        T *allocate(size_t count)
+        {
+            return static_cast<T *>(arena_->allocate(count * sizeof(T) , alignof(T)));
+        }
+
+        void deallocate(T *pointer , size_t count) noexcept
+        {
+            arena_->deallocate(pointer , count * sizeof(T) , alignof(T));
+        }
+
+        Arena *arena() const noexcept { return arena_; }
+
+    private:
+        Arena *arena_;
+    };
+
+    template<typename T , typename U , typename Arena>
+    bool operator==(const arena_allocator<T , Arena> &lhs , const arena_allocator<U , Arena> &rhs) noexcept
+    {
+        return lhs.arena() == rhs.arena();
+    }
+
+    template<typename T , typename U , typename Arena>
+    bool operator!=(const arena_allocator<T , Arena> &lhs , const arena_allocator<U , Arena> &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    /******************************************************************************
+     * Metafunction: arena_container_t
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the same container type taking its memory from an arena.
+     *   -For instance, arena_container_t<std::map<int, int>, pool_arena> is
+     *    std::map<int, int, std::less<int>, arena_allocator<std::pair<const int, int>, pool_arena>>.
+     *
+     * Template Parameters:
+     *   -C     : The allocator aware container type.
+     *   -Arena : The arena type, monotonic_arena or pool_arena.
+     *
+     *****************************************************************************/
+    template<typename C , typename Arena = monotonic_arena>
+    using arena_container_t = rebind_container_t<C , arena_allocator<unsigned char , Arena>>;
+
+}
+
+#endif // __ARENA_H__
@@ -11,6 +11,25 @@
 #ifndef __BASIC_H__
 #define __BASIC_H__
 
+#include <cstddef>
+
+/******************************************************************************
+ * Macro: TRAITS_HAS_BUILTIN
+ *-----------------------------------------------------------------------------
+ * Description:
+ *   -This macro expands to true if the compiler provides a given type trait builtin
+ *    (__is_same, __remove_cv, __is_class, ...).
+ *   -Metafunctions use the builtin when it is available, so they skip the instantiation
+ *    of partial specializations, and fall back to the portable implementation otherwise.
+ *   -Defining TRAITS_NO_BUILTINS before including the library forces the portable implementation.
+ *
+ *****************************************************************************/
+#if defined(__has_builtin) && !defined(TRAITS_NO_BUILTINS)
+#define TRAITS_HAS_BUILTIN(builtin) __has_builtin(builtin)
+#else
+#define TRAITS_HAS_BUILTIN(builtin) 0
+#endif
+
 namespace traits
 {
 	/******************************************************************************
@@ -116,6 +135,21 @@ namespace traits
 	template <typename...>
 		using void_t = void;
 
+	/******************************************************************************
+	 * Metafunction: declval
+	 *-----------------------------------------------------------------------------
+	 * Description:
+	 *   -This function returns an rvalue reference to a given type without constructing it.
+	 *   -It is only declared, so it can only be used in unevaluated contexts (decltype, sizeof).
+	 *   -It is used alongside void_t to detect expressions on types that can't be constructed.
+	 *
+	 * Template Parameters:
+	 *  -T : The type to refer to.
+	 *
+	 *****************************************************************************/
+	template <typename T>
+		T &&declval() noexcept;
+
 }
 
 
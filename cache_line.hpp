@@ -0,0 +1,102 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           cache_line.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file contains the definition of the metafunctions used to lay out data shared between
+ *                threads: the cache line size, a wrapper that gives a value a cache line of its own, and
+ *                the detection of lock-free atomics.
+ *
+ **************************************************************************************************************/
+
+#ifndef __CACHE_LINE_H__
+#define __CACHE_LINE_H__
+
+#include <atomic>
+
+#include "type_detector.hpp"
+
+/******************************************************************************
+ * Macro: TRAITS_CACHE_LINE_SIZE
+ *-----------------------------------------------------------------------------
+ * Description:
+ *   -This macro holds the size in bytes of a cache line of the target.
+ *   -It defaults to 128 on Apple silicon and 64 elsewhere, and can be defined before
+ *    including the library to match another target.
+ *
+ *****************************************************************************/
+#ifndef TRAITS_CACHE_LINE_SIZE
+#if defined(__APPLE__) && defined(__aarch64__)
+#define TRAITS_CACHE_LINE_SIZE 128
+#else
+#define TRAITS_CACHE_LINE_SIZE 64
+#endif
+#endif
+
+namespace traits
+{
+    /******************************************************************************
+     * Metafunction: cache_line_size
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the size in bytes of a cache line (TRAITS_CACHE_LINE_SIZE).
+     *   -Two objects written by different threads should not share a cache line,
+     *    otherwise every write invalidates the line in the cache of the other thread.
+     *
+     *****************************************************************************/
+    struct cache_line_size : integral_constant<size_t , TRAITS_CACHE_LINE_SIZE>{};
+
+    static constexpr size_t cache_line_size_v = cache_line_size::value;
+
+    /******************************************************************************
+     * Class: padded
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This class holds a value aligned to, and padded to a multiple of, the cache line size,
+     *    so an array of padded values gives every value its own cache lines.
+     *   -The constructor forwards its arguments to the value.
+     *
+     * Template Parameters:
+     *   -T : The type of the value.
+     *
+     *****************************************************************************/
+    template<typename T>
+    struct alignas(cache_line_size_v) padded
+    {
+        template<typename ...Args>
+        explicit padded(Args &&...args) : value(static_cast<Args &&>(args)...)
+        {
+        }
+
+        T &get() noexcept { return value; }
+
+        const T &get() const noexcept { return value; }
+
+        T value;
+    };
+
+    /******************************************************************************
+     * Metafunction: is_lock_free_atomic
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns true if std::atomic<T> is always lock free on the target.
+     *   -It is false for types that can't be atomic (not trivially copyable), without
+     *    instantiating std::atomic for them.
+     *
+     * Template Parameters:
+     *   -T : The type to check.
+     *
+     *****************************************************************************/
+    template<typename T>
+    struct atomic_always_lock_free : bool_constant<std::atomic<T>::is_always_lock_free>{};
+
+    template<typename T>
+    struct is_lock_free_atomic : conjunction<is_trivially_copyable<T> , atomic_always_lock_free<T>>{};
+
+    template<typename T>
+    static constexpr bool is_lock_free_atomic_v = is_lock_free_atomic<T>::value;
+
+}
+
+#endif // __CACHE_LINE_H__
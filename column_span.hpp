@@ -0,0 +1,56 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           column_span.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file contains the definition of a non-owning view over a contiguous array of elements.
+ *
+ **************************************************************************************************************/
+
+#ifndef __COLUMN_SPAN_H__
+#define __COLUMN_SPAN_H__
+
+#include "qualifier.hpp"
+
+namespace traits
+{
+    /******************************************************************************
+     * Class: column_span
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This class is a non-owning view over contiguous elements (a soa_vector column,
+     *    an array read in place from a buffer, ...).
+     *
+     * Template Parameters:
+     *   -T : The element type, const qualified for read-only views.
+     *
+     *****************************************************************************/
+    template<typename T>
+    class column_span
+    {
+    public:
+        using value_type = remove_cv_t<T>;
+
+        constexpr column_span(T *data , size_t size) noexcept : data_(data) , size_(size){}
+
+        constexpr T *data() const noexcept { return data_; }
+
+        constexpr size_t size() const noexcept { return size_; }
+
+        constexpr bool empty() const noexcept { return size_ == 0; }
+
+        constexpr T *begin() const noexcept { return data_; }
+
+        constexpr T *end() const noexcept { return data_ + size_; }
+
+        constexpr T &operator[](size_t index) const noexcept { return data_[index]; }
+
+    private:
+        T *data_;
+        size_t size_;
+    };
+
+}
+
+#endif // __COLUMN_SPAN_H__
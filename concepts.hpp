@@ -0,0 +1,117 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           concepts.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file contains the definition of C++20 concepts that mirror the value returning
+ *                metafunctions of the library (Integral for is_integral_v, Pointer for is_pointer_v, ...).
+ *                Constraining overloads with them replaces enable_if chains, so failed candidates are
+ *                rejected without substituting into a return or template parameter type.
+ *                The concepts are only defined when the compiler supports them.
+ *
+ **************************************************************************************************************/
+
+#ifndef __CONCEPTS_H__
+#define __CONCEPTS_H__
+
+#include "type_detector.hpp"
+
+#if defined(__cpp_concepts) && __cpp_concepts >= 201907L
+
+namespace traits
+{
+    /******************************************************************************
+     * Concept: Same
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This concept is satisfied if two types are the same (is_same_v).
+     *
+     *****************************************************************************/
+    template<typename T , typename U>
+    concept Same = is_same_v<T , U>;
+
+    /******************************************************************************
+     * Concept: Integral, FloatingPoint, Numeric
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -These concepts are satisfied by the integral, floating point and numeric types
+     *    (is_integral_v, is_floating_point_v, is_numeric_v).
+     *   -Numeric is written as a disjunction of the other two, so a type satisfying
+     *    Integral is considered more constrained than one satisfying Numeric.
+     *
+     *****************************************************************************/
+    template<typename T>
+    concept Integral = is_integral_v<T>;
+
+    template<typename T>
+    concept FloatingPoint = is_floating_point_v<T>;
+
+    template<typename T>
+    concept Numeric = Integral<T> || FloatingPoint<T>;
+
+    /******************************************************************************
+     * Concept: Signed, Unsigned
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -These concepts are satisfied by the signed and unsigned numeric types
+     *    (is_signed_v, is_unsigned_v).
+     *   -They are restricted to numeric types, since is_unsigned_v is also true for
+     *    types that have no sign at all.
+     *
+     *****************************************************************************/
+    template<typename T>
+    concept Signed = Numeric<T> && is_signed_v<T>;
+
+    template<typename T>
+    concept Unsigned = Numeric<T> && is_unsigned_v<T>;
+
+    /******************************************************************************
+     * Concept: Pointer, Reference, Array, Function, Class
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -These concepts are satisfied by the pointer, reference, array, function and class types
+     *    (is_pointer_v, is_reference_v, is_array_v, is_function_v, is_class_v).
+     *
+     *****************************************************************************/
+    template<typename T>
+    concept Pointer = is_pointer_v<T>;
+
+    template<typename T>
+    concept Reference = is_reference_v<T>;
+
+    template<typename T>
+    concept Array = is_array_v<T>;
+
+    template<typename T>
+    concept Function = is_function_v<T>;
+
+    template<typename T>
+    concept Class = is_class_v<T>;
+
+    /******************************************************************************
+     * Concept: Container
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This concept is satisfied by the container types (is_container_v).
+     *
+     *****************************************************************************/
+    template<typename T>
+    concept Container = is_container_v<T>;
+
+    /******************************************************************************
+     * Concept: TriviallyCopyable
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This concept is satisfied by the types that can be copied with memcpy
+     *    (is_trivially_copyable_v).
+     *
+     *****************************************************************************/
+    template<typename T>
+    concept TriviallyCopyable = is_trivially_copyable_v<T>;
+
+}
+
+#endif // __cpp_concepts
+
+#endif // __CONCEPTS_H__
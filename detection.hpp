@@ -0,0 +1,120 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           detection.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file contains the definition of the detection idiom metafunctions.
+ *                They turn an alias template naming an expression (decltype(declval<T&>().size()), ...)
+ *                into a trait, using void_t and SFINAE.
+ *
+ **************************************************************************************************************/
+
+#ifndef __DETECTION_H__
+#define __DETECTION_H__
+
+#include "basic.hpp"
+#include "logic.hpp"
+
+namespace traits
+{
+    /******************************************************************************
+     * Metafunction: nonesuch
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This type is returned by detected_t when the operation is not valid.
+     *   -It can't be constructed, copied or destroyed, so it never matches a real type.
+     *
+     *****************************************************************************/
+    struct nonesuch
+    {
+        nonesuch() = delete;
+        ~nonesuch() = delete;
+        nonesuch(const nonesuch &) = delete;
+        void operator=(const nonesuch &) = delete;
+    };
+
+    /******************************************************************************
+     * Metafunction: detected_or
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction applies an operation to a list of arguments.
+     *   -If the operation is valid, its type is Op<Args...> and its value_t is true_type.
+     *   -Otherwise, its type is Default and its value_t is false_type.
+     *
+     * Template Parameters:
+     *   -Default : The type to return if the operation is not valid.
+     *   -Op      : The alias template naming the operation.
+     *   -...Args : The arguments of the operation.
+     *
+     *****************************************************************************/
+    template<typename Default , typename Void , template<typename...> class Op , typename ...Args>
+    struct detector : type_is<Default>
+    {
+        using value_t = false_type;
+    };
+
+    template<typename Default , template<typename...> class Op , typename ...Args>
+    struct detector<Default , void_t<Op<Args...>> , Op , Args...> : type_is<Op<Args...>>
+    {
+        using value_t = true_type;
+    };
+
+    template<typename Default , template<typename...> class Op , typename ...Args>
+    using detected_or = detector<Default , void , Op , Args...>;
+
+    template<typename Default , template<typename...> class Op , typename ...Args>
+    using detected_or_t = typename detected_or<Default , Op , Args...>::type;
+
+    /******************************************************************************
+     * Metafunction: is_detected
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns true if an operation is valid for a list of arguments.
+     *
+     * Template Parameters:
+     *   -Op      : The alias template naming the operation.
+     *   -...Args : The arguments of the operation.
+     *
+     *****************************************************************************/
+    template<template<typename...> class Op , typename ...Args>
+    struct is_detected : detected_or<nonesuch , Op , Args...>::value_t{};
+
+    template<template<typename...> class Op , typename ...Args>
+    static constexpr bool is_detected_v = is_detected<Op , Args...>::value;
+
+    /******************************************************************************
+     * Metafunction: detected_t
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the type of an operation, or nonesuch if it is not valid.
+     *
+     * Template Parameters:
+     *   -Op      : The alias template naming the operation.
+     *   -...Args : The arguments of the operation.
+     *
+     *****************************************************************************/
+    template<template<typename...> class Op , typename ...Args>
+    using detected_t = detected_or_t<nonesuch , Op , Args...>;
+
+    /******************************************************************************
+     * Metafunction: is_detected_exact
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns true if an operation is valid and its type is exactly Expected.
+     *
+     * Template Parameters:
+     *   -Expected : The type the operation must have.
+     *   -Op       : The alias template naming the operation.
+     *   -...Args  : The arguments of the operation.
+     *
+     *****************************************************************************/
+    template<typename Expected , template<typename...> class Op , typename ...Args>
+    struct is_detected_exact : is_same<Expected , detected_t<Op , Args...>>{};
+
+    template<typename Expected , template<typename...> class Op , typename ...Args>
+    static constexpr bool is_detected_exact_v = is_detected_exact<Expected , Op , Args...>::value;
+
+}
+
+#endif // __DETECTION_H__
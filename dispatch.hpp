@@ -0,0 +1,88 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           dispatch.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file contains the definition of the type category tags and of a tag dispatch helper.
+ *                Selecting an implementation by overloading on a tag costs a single overload resolution,
+ *                instead of substituting into every candidate of an enable_if overload set.
+ *
+ **************************************************************************************************************/
+
+#ifndef __DISPATCH_H__
+#define __DISPATCH_H__
+
+#include "type_detector.hpp"
+
+namespace traits
+{
+    /******************************************************************************
+     * Metafunction: category tags
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -These empty types name the category of a type, one tag per detecting metafunction.
+     *
+     *****************************************************************************/
+    struct integral_tag{};
+
+    struct floating_point_tag{};
+
+    struct pointer_tag{};
+
+    struct array_tag{};
+
+    struct function_tag{};
+
+    struct container_tag{};
+
+    struct class_tag{};
+
+    struct other_tag{};
+
+    /******************************************************************************
+     * Metafunction: category_of
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the category tag of a given type.
+     *   -The categories are checked in order (integral, floating point, pointer, array,
+     *    function, container, class), so a container is tagged as a container and not as a class.
+     *
+     * Template Parameters:
+     *   -T : The type to categorize.
+     *
+     *****************************************************************************/
+    template<typename T>
+    struct category_of : if_type<is_integral_v<T>       , integral_tag,
+                         if_type_t<is_floating_point_v<T> , floating_point_tag,
+                         if_type_t<is_pointer_v<T>        , pointer_tag,
+                         if_type_t<is_array_v<T>          , array_tag,
+                         if_type_t<is_function_v<T>       , function_tag,
+                         if_type_t<is_container_v<T>      , container_tag,
+                         if_type_t<is_class_v<T>          , class_tag,
+                                                            other_tag>>>>>>>{};
+
+    template<typename T>
+    using category_of_t = typename category_of<T>::type;
+
+    /******************************************************************************
+     * Function: dispatch
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function calls f with the category tag of T followed by the given arguments.
+     *   -f is typically an overload set (a struct with one call operator per tag, or
+     *    a generic lambda), and the tag selects the implementation.
+     *
+     * Template Parameters:
+     *   -T : The type whose category selects the implementation.
+     *
+     *****************************************************************************/
+    template<typename T , typename F , typename ...Args>
+    constexpr decltype(auto) dispatch(F &&f , Args &&...args)
+    {
+        return static_cast<F &&>(f)(category_of_t<T>{} , static_cast<Args &&>(args)...);
+    }
+
+}
+
+#endif // __DISPATCH_H__
@@ -0,0 +1,324 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           function_traits.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file contains the definition of the metafunctions that describe the signature of
+ *                functions, function pointers, member function pointers and callable objects, of invoke
+ *                and invoke_result, and of function_ref, a non-owning callback two pointers wide.
+ *
+ **************************************************************************************************************/
+
+#ifndef __FUNCTION_TRAITS_H__
+#define __FUNCTION_TRAITS_H__
+
+#include "type_list.hpp"
+#include "type_detector.hpp"
+
+namespace traits
+{
+    /******************************************************************************
+     * Metafunction: function_traits
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction describes the signature of a function type, with:
+     *     -result_type    : the return type.
+     *     -arguments      : a type_list of the parameter types, argument_t<I> picks one.
+     *     -arity          : the number of parameters, not counting a C variadic ellipsis.
+     *     -is_noexcept, is_variadic, is_const, is_volatile and ref : the qualifiers.
+     *   -It also accepts function pointers and references, member function pointers (which
+     *    add class_type) and class types with a single operator() such as lambdas (described
+     *    by their operator()).
+     *   -For any other type it has no member, so it can be used with SFINAE.
+     *
+     * Template Parameters:
+     *   -F : The function or callable type.
+     *
+     *****************************************************************************/
+    enum class ref_qualifier
+    {
+        none,
+        lvalue,
+        rvalue
+    };
+
+    template<typename R , typename Arguments , bool Noexcept , bool Variadic , bool Const , bool Volatile , ref_qualifier Ref>
+    struct function_signature
+    {
+        using result_type = R;
+
+        using arguments = Arguments;
+
+        template<size_t I>
+        using argument_t = at_t<Arguments , I>;
+
+        static constexpr size_t arity = size_v<Arguments>;
+
+        static constexpr bool is_noexcept = Noexcept;
+
+        static constexpr bool is_variadic = Variadic;
+
+        static constexpr bool is_const = Const;
+
+        static constexpr bool is_volatile = Volatile;
+
+        static constexpr ref_qualifier ref = Ref;
+    };
+
+    template<typename F , typename = void>
+    struct callable_traits{};
+
+    template<typename F>
+    struct function_traits : callable_traits<F>{};
+
+    template<typename F>
+    struct callable_traits<F , void_t<decltype(&F::operator())>> : function_traits<decltype(&F::operator())>{};
+
+    template<typename F>
+    struct function_traits<const F> : function_traits<F>{};
+
+    template<typename F>
+    struct function_traits<volatile F> : function_traits<F>{};
+
+    template<typename F>
+    struct function_traits<const volatile F> : function_traits<F>{};
+
+    template<typename F>
+    struct function_traits<F *> : function_traits<F>{};
+
+    template<typename F>
+    struct function_traits<F &> : function_traits<F>{};
+
+    template<typename F>
+    struct function_traits<F &&> : function_traits<F>{};
+
+// One pair of specializations (plain and variadic) per qualifier combination, for functions and member function pointers.
+#define TRAITS_FUNCTION_TRAITS(QUALIFIERS , NOEXCEPT , CONST , VOLATILE , REF)                                               \
+    template<typename R , typename ...Args>                                                                                   \
+    struct function_traits<R(Args...) QUALIFIERS noexcept(NOEXCEPT)>                                                          \
+        : function_signature<R , type_list<Args...> , NOEXCEPT , false , CONST , VOLATILE , ref_qualifier::REF>{};             \
+                                                                                                                              \
+    template<typename R , typename ...Args>                                                                                   \
+    struct function_traits<R(Args... , ...) QUALIFIERS noexcept(NOEXCEPT)>                                                    \
+        : function_signature<R , type_list<Args...> , NOEXCEPT , true , CONST , VOLATILE , ref_qualifier::REF>{};              \
+                                                                                                                              \
+    template<typename R , typename C , typename ...Args>                                                                      \
+    struct function_traits<R(C::*)(Args...) QUALIFIERS noexcept(NOEXCEPT)> : function_traits<R(Args...) QUALIFIERS noexcept(NOEXCEPT)> \
+    {                                                                                                                         \
+        using class_type = C;                                                                                                 \
+    };                                                                                                                        \
+                                                                                                                              \
+    template<typename R , typename C , typename ...Args>                                                                      \
+    struct function_traits<R(C::*)(Args... , ...) QUALIFIERS noexcept(NOEXCEPT)> : function_traits<R(Args... , ...) QUALIFIERS noexcept(NOEXCEPT)> \
+    {                                                                                                                         \
+        using class_type = C;                                                                                                 \
+    };
+
+#define TRAITS_FUNCTION_TRAITS_NOEXCEPT(QUALIFIERS , CONST , VOLATILE , REF)                                                \
+    TRAITS_FUNCTION_TRAITS(QUALIFIERS , false , CONST , VOLATILE , REF)                                                     \
+    TRAITS_FUNCTION_TRAITS(QUALIFIERS , true , CONST , VOLATILE , REF)
+
+    TRAITS_FUNCTION_TRAITS_NOEXCEPT(                   , false , false , none)
+    TRAITS_FUNCTION_TRAITS_NOEXCEPT(const              , true  , false , none)
+    TRAITS_FUNCTION_TRAITS_NOEXCEPT(volatile           , false , true  , none)
+    TRAITS_FUNCTION_TRAITS_NOEXCEPT(const volatile     , true  , true  , none)
+    TRAITS_FUNCTION_TRAITS_NOEXCEPT(&                  , false , false , lvalue)
+    TRAITS_FUNCTION_TRAITS_NOEXCEPT(const &            , true  , false , lvalue)
+    TRAITS_FUNCTION_TRAITS_NOEXCEPT(volatile &         , false , true  , lvalue)
+    TRAITS_FUNCTION_TRAITS_NOEXCEPT(const volatile &   , true  , true  , lvalue)
+    TRAITS_FUNCTION_TRAITS_NOEXCEPT(&&                 , false , false , rvalue)
+    TRAITS_FUNCTION_TRAITS_NOEXCEPT(const &&           , true  , false , rvalue)
+    TRAITS_FUNCTION_TRAITS_NOEXCEPT(volatile &&        , false , true  , rvalue)
+    TRAITS_FUNCTION_TRAITS_NOEXCEPT(const volatile &&  , true  , true  , rvalue)
+
+#undef TRAITS_FUNCTION_TRAITS_NOEXCEPT
+#undef TRAITS_FUNCTION_TRAITS
+
+    template<typename F>
+    using result_type_t = typename function_traits<F>::result_type;
+
+    template<typename F>
+    using arguments_t = typename function_traits<F>::arguments;
+
+    template<typename F>
+    static constexpr size_t arity_v = function_traits<F>::arity;
+
+    /******************************************************************************
+     * Function: invoke
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function calls a callable with a list of arguments.
+     *   -Member function pointers are called on their first argument, which is an object,
+     *    a reference or a pointer, and member data pointers return the member of it.
+     *   -It doesn't take part in overload resolution when the call is not valid.
+     *
+     *****************************************************************************/
+    template<typename F , typename ...Args>
+    constexpr auto invoke(F &&f , Args &&...args)
+        -> decltype(static_cast<F &&>(f)(static_cast<Args &&>(args)...))
+    {
+        return static_cast<F &&>(f)(static_cast<Args &&>(args)...);
+    }
+
+    template<typename M , typename C , typename Object , typename ...Args>
+    constexpr auto invoke(M C::*f , Object &&object , Args &&...args)
+        -> decltype((static_cast<Object &&>(object).*f)(static_cast<Args &&>(args)...))
+    {
+        return (static_cast<Object &&>(object).*f)(static_cast<Args &&>(args)...);
+    }
+
+    template<typename M , typename C , typename Object , typename ...Args>
+    constexpr auto invoke(M C::*f , Object &&object , Args &&...args)
+        -> decltype(((*static_cast<Object &&>(object)).*f)(static_cast<Args &&>(args)...))
+    {
+        return ((*static_cast<Object &&>(object)).*f)(static_cast<Args &&>(args)...);
+    }
+
+    template<typename M , typename C , typename Object>
+    constexpr auto invoke(M C::*member , Object &&object) -> decltype(static_cast<Object &&>(object).*member)
+    {
+        return static_cast<Object &&>(object).*member;
+    }
+
+    template<typename M , typename C , typename Object>
+    constexpr auto invoke(M C::*member , Object &&object) -> decltype((*static_cast<Object &&>(object)).*member)
+    {
+        return (*static_cast<Object &&>(object)).*member;
+    }
+
+    /******************************************************************************
+     * Metafunction: invoke_result, is_invocable
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -invoke_result returns the type of invoke(F, Args...), and has no type member when
+     *    the call is not valid.
+     *   -is_invocable returns true if the call is valid.
+     *
+     * Template Parameters:
+     *   -F       : The callable type.
+     *   -...Args : The argument types.
+     *
+     *****************************************************************************/
+    template<typename F , typename ...Args>
+    using invoke_expression = decltype(traits::invoke(declval<F>() , declval<Args>()...));
+
+    template<typename Void , typename F , typename ...Args>
+    struct invoke_result_helper{};
+
+    template<typename F , typename ...Args>
+    struct invoke_result_helper<void_t<invoke_expression<F , Args...>> , F , Args...> : type_is<invoke_expression<F , Args...>>{};
+
+    template<typename F , typename ...Args>
+    struct invoke_result : invoke_result_helper<void , F , Args...>{};
+
+    template<typename F , typename ...Args>
+    using invoke_result_t = typename invoke_result<F , Args...>::type;
+
+    template<typename F , typename ...Args>
+    struct is_invocable : is_detected<invoke_expression , F , Args...>{};
+
+    template<typename F , typename ...Args>
+    static constexpr bool is_invocable_v = is_invocable<F , Args...>::value;
+
+    /******************************************************************************
+     * Metafunction: is_convertible
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns true if From can be implicitly converted to To.
+     *   -Every type is convertible to void.
+     *
+     * Template Parameters:
+     *   -From : The source type.
+     *   -To   : The destination type.
+     *
+     *****************************************************************************/
+    template<typename To>
+    void implicit_conversion(To) noexcept;
+
+    template<typename From , typename To>
+    using conversion_expression = decltype(implicit_conversion<To>(declval<From>()));
+
+    template<typename From , typename To>
+    struct is_convertible : Or<is_same_v<remove_cv_t<To> , void> , is_detected_v<conversion_expression , From , To>>{};
+
+    template<typename From , typename To>
+    static constexpr bool is_convertible_v = is_convertible<From , To>::value;
+
+    /******************************************************************************
+     * Class: function_ref
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This class refers to a callable that can be called with Args... and returns something
+     *    convertible to R, and forwards calls to it.
+     *   -It is two pointers wide: the address of the callable (or the function pointer itself)
+     *    and a thunk that knows its type. It never allocates and never owns the callable,
+     *    so the callable must outlive the function_ref, as with any reference.
+     *   -It is cheap to copy and is meant to be passed by value, as a callback parameter.
+     *
+     * Template Parameters:
+     *   -Signature : The call signature, R(Args...).
+     *
+     *****************************************************************************/
+    template<typename F>
+    struct is_function_pointer : false_type{};
+
+    template<typename F>
+    struct is_function_pointer<F *> : is_function<F>{};
+
+    template<typename Signature>
+    class function_ref;
+
+    template<typename R , typename ...Args>
+    class function_ref<R(Args...)>
+    {
+        union storage
+        {
+            void *object;
+            void (*function)();
+        };
+
+        template<typename F>
+        using accepts = enable_if_t<And<!is_same_v<remove_cvref_t<F> , function_ref> ,
+                                        !is_function_v<remove_reference_t<F>> ,
+                                        !is_function_pointer<remove_cvref_t<F>>::value ,
+                                        is_convertible_v<invoke_result_t<F & , Args...> , R>>::value , void>;
+
+    public:
+        template<typename F , typename = accepts<F>>
+        function_ref(F &&f) noexcept : callback_(&call_object<remove_reference_t<F>>)
+        {
+            storage_.object = const_cast<void *>(static_cast<const volatile void *>(&f));
+        }
+
+        template<typename F , typename = enable_if_t<And<is_function_v<F> , is_convertible_v<invoke_result_t<F * , Args...> , R>>::value , void>>
+        function_ref(F *f) noexcept : callback_(&call_function<F>)
+        {
+            storage_.function = reinterpret_cast<void (*)()>(f);
+        }
+
+        R operator()(Args ...args) const
+        {
+            return callback_(storage_ , static_cast<Args &&>(args)...);
+        }
+
+    private:
+        template<typename F>
+        static R call_object(storage s , Args &&...args)
+        {
+            return static_cast<R>(traits::invoke(*static_cast<F *>(s.object) , static_cast<Args &&>(args)...));
+        }
+
+        template<typename F>
+        static R call_function(storage s , Args &&...args)
+        {
+            return static_cast<R>(traits::invoke(reinterpret_cast<F *>(s.function) , static_cast<Args &&>(args)...));
+        }
+
+        storage storage_;
+        R (*callback_)(storage , Args &&...);
+    };
+
+}
+
+#endif // __FUNCTION_TRAITS_H__
@@ -0,0 +1,135 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           integer_width.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file contains the definition of metafunctions that deal with the range of integral
+ *                types and that select the narrowest integral type able to hold a range of values.
+ *
+ **************************************************************************************************************/
+
+#ifndef __INTEGER_WIDTH_H__
+#define __INTEGER_WIDTH_H__
+
+#include "type_detector.hpp"
+
+namespace traits
+{
+    /******************************************************************************
+     * Metafunction: bit_width_of
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the number of bits of an integral type.
+     *
+     * Template Parameters:
+     *   -T : The integral type.
+     *
+     *****************************************************************************/
+    template<typename T>
+    struct bit_width_of : integral_constant<size_t , sizeof(T) * 8>{};
+
+    template<typename T>
+    static constexpr size_t bit_width_of_v = bit_width_of<T>::value;
+
+    /******************************************************************************
+     * Metafunction: integral_max, integral_min
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -These metafunctions return the largest and smallest values of an integral type.
+     *   -They rely on is_signed to choose between the two's complement and the unsigned range.
+     *
+     * Template Parameters:
+     *   -T : The integral type.
+     *
+     *****************************************************************************/
+    template<typename T>
+    struct integral_max : integral_constant<T , static_cast<T>(is_signed_v<T>
+                                                                ? (1ULL << (bit_width_of_v<T> - 1)) - 1
+                                                                : ~0ULL >> (64 - bit_width_of_v<T>))>
+    {
+        static_assert(is_integral_v<T> , "integral_max needs an integral type");
+    };
+
+    template<typename T>
+    static constexpr T integral_max_v = integral_max<T>::value;
+
+    template<typename T>
+    struct integral_min : integral_constant<T , static_cast<T>(is_signed_v<T> ? -integral_max_v<T> - 1 : 0)>
+    {
+        static_assert(is_integral_v<T> , "integral_min needs an integral type");
+    };
+
+    template<typename T>
+    static constexpr T integral_min_v = integral_min<T>::value;
+
+    /******************************************************************************
+     * Metafunction: smallest_uint_for
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the narrowest unsigned type able to hold every value in [0, MaxValue].
+     *
+     * Template Parameters:
+     *   -MaxValue : The largest value to hold.
+     *
+     *****************************************************************************/
+    template<unsigned long long MaxValue>
+    struct smallest_uint_for : if_type<(MaxValue <= integral_max_v<unsigned char>)  , unsigned char,
+                               if_type_t<(MaxValue <= integral_max_v<unsigned short>) , unsigned short,
+                               if_type_t<(MaxValue <= integral_max_v<unsigned int>)   , unsigned int,
+                                                                                        unsigned long long>>>{};
+
+    template<unsigned long long MaxValue>
+    using smallest_uint_for_t = typename smallest_uint_for<MaxValue>::type;
+
+    /******************************************************************************
+     * Metafunction: smallest_int_for
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the narrowest signed type able to hold every value in [MinValue, MaxValue].
+     *
+     * Template Parameters:
+     *   -MinValue : The smallest value to hold.
+     *   -MaxValue : The largest value to hold.
+     *
+     *****************************************************************************/
+    template<typename T , long long MinValue , long long MaxValue>
+    struct holds_range : bool_constant<(MinValue >= integral_min_v<T> && MaxValue <= integral_max_v<T>)>{};
+
+    template<long long MinValue , long long MaxValue>
+    struct smallest_int_for : if_type<holds_range<signed char , MinValue , MaxValue>::value , signed char,
+                              if_type_t<holds_range<short , MinValue , MaxValue>::value    , short,
+                              if_type_t<holds_range<int , MinValue , MaxValue>::value      , int,
+                                                                                            long long>>>
+    {
+        static_assert(MinValue <= MaxValue , "smallest_int_for needs MinValue <= MaxValue");
+    };
+
+    template<long long MinValue , long long MaxValue>
+    using smallest_int_for_t = typename smallest_int_for<MinValue , MaxValue>::type;
+
+    /******************************************************************************
+     * Metafunction: uint_for_bits
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the narrowest unsigned type with at least Bits bits.
+     *
+     * Template Parameters:
+     *   -Bits : The number of bits to hold, from 1 to 64.
+     *
+     *****************************************************************************/
+    template<size_t Bits>
+    struct uint_for_bits : if_type<(Bits <= bit_width_of_v<unsigned char>)  , unsigned char,
+                           if_type_t<(Bits <= bit_width_of_v<unsigned short>) , unsigned short,
+                           if_type_t<(Bits <= bit_width_of_v<unsigned int>)   , unsigned int,
+                                                                                unsigned long long>>>
+    {
+        static_assert(Bits > 0 && Bits <= 64 , "uint_for_bits needs between 1 and 64 bits");
+    };
+
+    template<size_t Bits>
+    using uint_for_bits_t = typename uint_for_bits<Bits>::type;
+
+}
+
+#endif // __INTEGER_WIDTH_H__
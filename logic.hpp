@@ -27,6 +27,13 @@ namespace traits
      *   -U : The second type.
 	 *
 	 *****************************************************************************/
+#if TRAITS_HAS_BUILTIN(__is_same)
+    template<typename T , typename U>
+    struct is_same : bool_constant<__is_same(T,U)>{};
+
+    template<typename T , typename U>
+    static constexpr bool is_same_v = __is_same(T,U);
+#else
     template<typename T , typename U>
     struct is_same : false_type{};
 
@@ -35,6 +42,7 @@ namespace traits
 
     template<typename T , typename U>
     static constexpr bool is_same_v = is_same<T,U>::value;  
+#endif
 
     /******************************************************************************
 	 * Metafunction: is_same_raw
@@ -74,25 +82,43 @@ namespace traits
     template<bool B , typename T , typename U>
     using if_type_t = typename if_type<B,T,U>::type;
 
+    /******************************************************************************
+	 * Metafunction: lazy_if
+	 *-----------------------------------------------------------------------------
+	 * Description:
+	 *   -This metafunction returns F<Args...>::type if B is true, G<Args...>::type otherwise.
+     *   -Unlike if_type_t<B, typename F<Args...>::type, typename G<Args...>::type>, only the
+     *    selected metafunction is instantiated: the other one is named but never completed.
+     *   -F and G must be class templates, alias templates would be substituted eagerly.
+	 *
+	 * Template Parameters:
+	 *   -B       : The boolean condition.
+     *   -F       : The metafunction to evaluate if B is true.
+     *   -G       : The metafunction to evaluate if B is false.
+     *   -...Args : The arguments passed to the selected metafunction.
+	 *
+	 *****************************************************************************/
+    template<bool B , template<typename...> class F , template<typename...> class G , typename ...Args>
+    struct lazy_if : if_type_t<B , F<Args...> , G<Args...>>{};
+
+    template<bool B , template<typename...> class F , template<typename...> class G , typename ...Args>
+    using lazy_if_t = typename lazy_if<B , F , G , Args...>::type;
+
     /******************************************************************************
 	 * Metafunction: And
 	 *-----------------------------------------------------------------------------
 	 * Description:
 	 *   -This variadic metafunction returns true if all of its arguments are true.
      *   -It must be used with at least one argument.
+     *   -It is implemented as a fold expression, so its instantiation depth is constant.
+     *   -All of the arguments are evaluated, use conjunction to short-circuit on traits.
 	 * Template Parameters:
      *   - cond         : The first boolean argument.
 	 *   -...conditions : The rest of the boolean arguments.
 	 *****************************************************************************/
 
     template<bool cond , bool... conditions>
-    struct And;
-
-    template<bool condition>
-    struct And<condition> : bool_constant<condition>{};
-
-    template<bool cond1 , bool cond2 , bool ...conditions>
-    struct And<cond1 , cond2, conditions...> : And< cond1&&cond2 , conditions...>{};
+    struct And : bool_constant<(cond && ... && conditions)>{};
 
     template<bool cond , bool... conditions>
     static constexpr bool And_v = And<cond,conditions...>::value;
@@ -103,19 +129,15 @@ namespace traits
 	 * Description:
 	 *   -This metafunction returns true if at least one of its arguments is true.
      *   -It must be used with at least one argument.
+     *   -It is implemented as a fold expression, so its instantiation depth is constant.
+     *   -All of the arguments are evaluated, use disjunction to short-circuit on traits.
 	 * Template Parameters:
      *   - cond         : The first boolean argument.
 	 *   -...conditions : The rest of the boolean arguments.
 	 *****************************************************************************/
 
     template<bool cond , bool... conditions>
-    struct Or;
-
-    template<bool condition>
-    struct Or<condition> : bool_constant<condition>{};
-
-    template<bool cond1 , bool cond2 , bool ...conditions>
-    struct Or<cond1 , cond2, conditions...> : Or< cond1||cond2 , conditions...>{};
+    struct Or : bool_constant<(cond || ... || conditions)>{};
 
     template<bool cond , bool... conditions>
     static constexpr bool Or_v = Or<cond,conditions...>::value;
@@ -136,34 +158,127 @@ namespace traits
     template<bool condition>
     static constexpr bool Not_v = Not<condition>::value;
 
+    /******************************************************************************
+	 * Metafunction: conjunction
+	 *-----------------------------------------------------------------------------
+	 * Description:
+	 *   -This metafunction performs a logical AND on a sequence of traits.
+     *   -It short-circuits: the traits following the first one whose value is false are never instantiated.
+     *   -It inherits from the first false trait, or from the last trait if all of them are true.
+     *   -It returns true when used with no traits.
+	 *
+	 * Template Parameters:
+	 *   -...Traits : The traits to combine, each one must have a static bool-convertible value.
+     * 
+	 *****************************************************************************/
+    template<typename ...Traits>
+    struct conjunction : true_type{};
+
+    template<typename Trait>
+    struct conjunction<Trait> : Trait{};
+
+    template<typename Trait , typename ...Traits>
+    struct conjunction<Trait , Traits...> : if_type_t<bool(Trait::value) , conjunction<Traits...> , Trait>{};
+
+    template<typename ...Traits>
+    static constexpr bool conjunction_v = conjunction<Traits...>::value;
+
+    /******************************************************************************
+	 * Metafunction: disjunction
+	 *-----------------------------------------------------------------------------
+	 * Description:
+	 *   -This metafunction performs a logical OR on a sequence of traits.
+     *   -It short-circuits: the traits following the first one whose value is true are never instantiated.
+     *   -It inherits from the first true trait, or from the last trait if all of them are false.
+     *   -It returns false when used with no traits.
+	 *
+	 * Template Parameters:
+	 *   -...Traits : The traits to combine, each one must have a static bool-convertible value.
+     * 
+	 *****************************************************************************/
+    template<typename ...Traits>
+    struct disjunction : false_type{};
+
+    template<typename Trait>
+    struct disjunction<Trait> : Trait{};
+
+    template<typename Trait , typename ...Traits>
+    struct disjunction<Trait , Traits...> : if_type_t<bool(Trait::value) , Trait , disjunction<Traits...>>{};
+
+    template<typename ...Traits>
+    static constexpr bool disjunction_v = disjunction<Traits...>::value;
+
+    /******************************************************************************
+	 * Metafunction: negation
+	 *-----------------------------------------------------------------------------
+	 * Description:
+	 *   -This metafunction returns the logical invert of a trait.
+     *   -Unlike Not, it takes the trait itself, so it can be passed to conjunction and disjunction
+     *    without forcing the trait to be evaluated early.
+	 *
+	 * Template Parameters:
+	 *   -Trait : The trait to invert.
+     * 
+	 *****************************************************************************/
+    template<typename Trait>
+    struct negation : bool_constant<!bool(Trait::value)>{};
+
+    template<typename Trait>
+    static constexpr bool negation_v = negation<Trait>::value;
+
     /******************************************************************************
 	 * Metafunction: is_in_pack
 	 *-----------------------------------------------------------------------------
 	 * Description:
 	 *   -This metafunction returns true if a type is in a pack of types.
      *   -It is very useful in implementing type checking metafunctions (is_integral , is_floating_point , ...)
-     *   -It must be used with at least one type.
+     *   -The pack is searched with a single fold expression instead of peeling one type
+     *    per specialization, so the instantiation depth doesn't grow with the pack size.
      *   
 	 *
 	 * Template Parameters:
 	 *   -T : The type to search for.
-     *  -...types : The pack of types to search in.
+     *  -...types : The pack of types to search in (may be empty).
      * 
 	 *****************************************************************************/
     template<typename T, typename ...types>
-    struct is_in_pack;
+    struct is_in_pack : bool_constant<(is_same_v<T,types> || ...)>{};
 
-    template<typename T>
-    struct is_in_pack<T> : false_type{};
+    template<typename T, typename ...types>
+    static constexpr bool is_in_pack_v = is_in_pack<T,types...>::value;
 
+    /******************************************************************************
+	 * Metafunction: index_of_in_pack
+	 *-----------------------------------------------------------------------------
+	 * Description:
+	 *   -This metafunction returns the zero-based position of the first occurrence of a type in a pack.
+     *   -If the type is not in the pack, it returns the size of the pack (one past the last position).
+     *   -The position is computed by a constexpr scan over an array of matches, so it also
+     *    has a constant instantiation depth.
+	 *
+	 * Template Parameters:
+	 *   -T : The type to search for.
+     *  -...types : The pack of types to search in (may be empty).
+     * 
+	 *****************************************************************************/
     template<typename T, typename ...types>
-    struct is_in_pack<T,T,types...> : true_type{};
+    constexpr size_t index_of_in_pack_helper()
+    {
+        constexpr bool matches[] = {is_same_v<T,types>... , true};
 
-    template<typename T,typename type1 , typename ...otherTypes>
-    struct is_in_pack<T,type1, otherTypes...> : is_in_pack<T,otherTypes...>{};
+        size_t index = 0;
+        while(!matches[index])
+        {
+            ++index;
+        }
+        return index;
+    }
 
     template<typename T, typename ...types>
-    static constexpr bool is_in_pack_v = is_in_pack<T,types...>::value;
+    struct index_of_in_pack : integral_constant<size_t , index_of_in_pack_helper<T,types...>()>{};
+
+    template<typename T, typename ...types>
+    static constexpr size_t index_of_in_pack_v = index_of_in_pack<T,types...>::value;
 
     /******************************************************************************
 	 * Metafunction: enable_if
@@ -0,0 +1,109 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           metafunction.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file contains the definition of quoted metafunctions and of the combinators that build
+ *                new metafunctions out of them. A quoted metafunction is a plain type with a nested apply
+ *                template, so it can be stored in a type list, passed around and combined, and nothing is
+ *                evaluated until the ::type of the final result is asked for.
+ *
+ **************************************************************************************************************/
+
+#ifndef __METAFUNCTION_H__
+#define __METAFUNCTION_H__
+
+#include "basic.hpp"
+
+namespace traits
+{
+    /******************************************************************************
+     * Metafunction: quote
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction turns a class template into a quoted metafunction:
+     *    quote<F>::apply<Args...> is F<Args...>.
+     *   -F must be a class template, alias templates can't be expanded from a pack
+     *    when their parameter list is fixed.
+     *
+     * Template Parameters:
+     *   -F : The metafunction to quote (remove_cv, is_pointer, ...).
+     *
+     *****************************************************************************/
+    template<template<typename...> class F>
+    struct quote
+    {
+        template<typename ...Args>
+        struct apply : F<Args...>{};
+    };
+
+    /******************************************************************************
+     * Metafunction: apply
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction calls a quoted metafunction with a list of arguments.
+     *   -apply<Q, Args...> is the result itself, with its ::type or ::value, and
+     *    apply_t<Q, Args...> is its ::type.
+     *
+     * Template Parameters:
+     *   -Q       : The quoted metafunction.
+     *   -...Args : The arguments.
+     *
+     *****************************************************************************/
+    template<typename Q , typename ...Args>
+    struct apply : Q::template apply<Args...>{};
+
+    template<typename Q , typename ...Args>
+    using apply_t = typename apply<Q , Args...>::type;
+
+    /******************************************************************************
+     * Metafunction: compose
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the quoted composition of quoted metafunctions, applied
+     *    from right to left: compose<F, G>::apply<Args...> is F::apply<G::apply<Args...>::type>.
+     *   -The last metafunction receives all the arguments, every other one receives
+     *    the ::type of the next one.
+     *
+     * Template Parameters:
+     *   -...Qs : The quoted metafunctions, at least one.
+     *
+     *****************************************************************************/
+    template<typename Q , typename ...Qs>
+    struct compose
+    {
+        template<typename ...Args>
+        struct apply : Q::template apply<apply_t<compose<Qs...> , Args...>>{};
+    };
+
+    template<typename Q>
+    struct compose<Q>
+    {
+        template<typename ...Args>
+        struct apply : Q::template apply<Args...>{};
+    };
+
+    /******************************************************************************
+     * Metafunction: bind_front
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction fixes the first arguments of a quoted metafunction:
+     *    bind_front<Q, Bound...>::apply<Args...> is Q::apply<Bound..., Args...>.
+     *   -For instance, bind_front<quote<is_same>, int> is a quoted "is int" predicate.
+     *
+     * Template Parameters:
+     *   -Q        : The quoted metafunction.
+     *   -...Bound : The arguments to put first.
+     *
+     *****************************************************************************/
+    template<typename Q , typename ...Bound>
+    struct bind_front
+    {
+        template<typename ...Args>
+        struct apply : Q::template apply<Bound... , Args...>{};
+    };
+
+}
+
+#endif // __METAFUNCTION_H__
@@ -0,0 +1,268 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           numeric_text.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file contains the definition of functions that parse numbers from text and format them
+ *                to text. The implementation is selected at compile time from the category of the type:
+ *                integers are converted by hand, two digits at a time when formatting, and floating point
+ *                numbers go through <charconv>, which gives the shortest text that reads back exactly.
+ *                Nothing allocates, depends on the locale or throws.
+ *
+ **************************************************************************************************************/
+
+#ifndef __NUMERIC_TEXT_H__
+#define __NUMERIC_TEXT_H__
+
+#include <charconv>
+#include <limits>
+
+#include "dispatch.hpp"
+#include "integer_width.hpp"
+
+namespace traits
+{
+    /******************************************************************************
+     * Metafunction: is_text_convertible
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns true if parse and format support a type, that is
+     *    for every integral type except bool, and for every floating point type.
+     *
+     * Template Parameters:
+     *   -T : The type to check.
+     *
+     *****************************************************************************/
+    template<typename T>
+    struct is_text_convertible : And<is_numeric_v<T> , !is_same_v<remove_cv_t<T> , bool>>{};
+
+    template<typename T>
+    static constexpr bool is_text_convertible_v = is_text_convertible<T>::value;
+
+    /******************************************************************************
+     * Metafunction: format_buffer_size
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the number of characters format may write for a type,
+     *    the output buffer must be at least that long.
+     *   -For integers it is the number of digits of the largest value, plus one for the sign.
+     *   -For floating point numbers it is sign, point, 'e', exponent sign, the significant
+     *    digits and the exponent digits.
+     *
+     * Template Parameters:
+     *   -T : The type to format.
+     *
+     *****************************************************************************/
+    constexpr size_t decimal_digit_count(unsigned long long value) noexcept
+    {
+        size_t count = 1;
+        while(value >= 10)
+        {
+            value /= 10;
+            ++count;
+        }
+        return count;
+    }
+
+    template<typename T>
+    struct format_buffer_size
+        : integral_constant<size_t , is_integral_v<T>
+                                     ? decimal_digit_count(static_cast<unsigned long long>(integral_max_v<if_type_t<is_integral_v<T> , T , int>>)) + is_signed_v<T>
+                                     : 4 + std::numeric_limits<T>::max_digits10 + decimal_digit_count(std::numeric_limits<T>::max_exponent10)>{};
+
+    template<typename T>
+    static constexpr size_t format_buffer_size_v = format_buffer_size<T>::value;
+
+    /******************************************************************************
+     * Class: parse_result
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This class holds the result of parse.
+     *   -On success, value is the parsed number and end points past its last character.
+     *   -If the text doesn't start with a number, status is invalid and end is equal to first.
+     *   -If the number doesn't fit in T, status is out_of_range and end points past the number.
+     *
+     *****************************************************************************/
+    enum class parse_status
+    {
+        ok,
+        invalid,
+        out_of_range
+    };
+
+    template<typename T>
+    struct parse_result
+    {
+        T value;
+        const char *end;
+        parse_status status;
+
+        explicit operator bool() const noexcept { return status == parse_status::ok; }
+    };
+
+    /******************************************************************************
+     * Function: format
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function writes the decimal text of a number to out and returns the end of the text.
+     *   -out must have room for format_buffer_size_v<T> characters, no terminating null is written.
+     *   -Integers are written without leading zeros, floating point numbers use the shortest
+     *    text that parses back to the same value.
+     *
+     * Template Parameters:
+     *   -T : The number type, it must satisfy is_text_convertible.
+     *
+     *****************************************************************************/
+    static constexpr char decimal_digit_pairs[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+    template<typename U>
+    char *format_unsigned(char *out , U value) noexcept
+    {
+        size_t count = 1;
+        for(U rest = value ; rest >= 10 ; rest /= 10)
+        {
+            ++count;
+        }
+
+        char *end = out + count;
+        char *position = end;
+        while(value >= 100)
+        {
+            const size_t pair = static_cast<size_t>(value % 100) * 2;
+            value /= 100;
+            *--position = decimal_digit_pairs[pair + 1];
+            *--position = decimal_digit_pairs[pair];
+        }
+        if(value >= 10)
+        {
+            const size_t pair = static_cast<size_t>(value) * 2;
+            *--position = decimal_digit_pairs[pair + 1];
+            *--position = decimal_digit_pairs[pair];
+        }
+        else
+        {
+            *--position = static_cast<char>('0' + value);
+        }
+        return end;
+    }
+
+    template<typename T>
+    char *format_helper(char *out , T value , integral_tag) noexcept
+    {
+        using unsigned_type = uint_for_bits_t<bit_width_of_v<T>>;
+
+        unsigned_type magnitude = static_cast<unsigned_type>(value);
+        if(is_signed_v<T> && value < T{0})
+        {
+            *out++ = '-';
+            magnitude = static_cast<unsigned_type>(0 - magnitude);
+        }
+        return format_unsigned(out , magnitude);
+    }
+
+    template<typename T>
+    char *format_helper(char *out , T value , floating_point_tag) noexcept
+    {
+        return std::to_chars(out , out + format_buffer_size_v<T> , value).ptr;
+    }
+
+    template<typename T>
+    char *format(char *out , T value) noexcept
+    {
+        static_assert(is_text_convertible_v<T> , "format needs a non-bool integral or floating point type");
+        return format_helper(out , value , category_of_t<T>{});
+    }
+
+    /******************************************************************************
+     * Function: parse
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function reads a decimal number at the start of [first, last).
+     *   -Integers are an optional '-' (for signed types only) followed by digits.
+     *   -Floating point numbers follow std::from_chars with the general format
+     *    (fixed or scientific, inf and nan).
+     *   -A leading '+' or whitespace is not accepted.
+     *
+     * Template Parameters:
+     *   -T : The number type, it must satisfy is_text_convertible.
+     *
+     *****************************************************************************/
+    template<typename T>
+    parse_result<T> parse_helper(const char *first , const char *last , integral_tag) noexcept
+    {
+        using unsigned_type = uint_for_bits_t<bit_width_of_v<T>>;
+
+        const char *position = first;
+        const bool negative = is_signed_v<T> && position != last && *position == '-';
+        if(negative)
+        {
+            ++position;
+        }
+
+        const unsigned_type limit = static_cast<unsigned_type>(static_cast<unsigned_type>(integral_max_v<T>) + negative);
+
+        const char *digits = position;
+        unsigned_type value = 0;
+        bool overflow = false;
+        for(; position != last ; ++position)
+        {
+            const unsigned digit = static_cast<unsigned>(*position - '0');
+            if(digit > 9)
+            {
+                break;
+            }
+            if(value > static_cast<unsigned_type>((limit - digit) / 10))
+            {
+                overflow = true;
+            }
+            value = static_cast<unsigned_type>(value * 10 + digit);
+        }
+
+        if(position == digits)
+        {
+            return {T{} , first , parse_status::invalid};
+        }
+        if(overflow)
+        {
+            return {T{} , position , parse_status::out_of_range};
+        }
+        return {static_cast<T>(negative ? static_cast<unsigned_type>(0 - value) : value) , position , parse_status::ok};
+    }
+
+    template<typename T>
+    parse_result<T> parse_helper(const char *first , const char *last , floating_point_tag) noexcept
+    {
+        T value{};
+        const std::from_chars_result result = std::from_chars(first , last , value);
+        if(result.ec == std::errc::invalid_argument)
+        {
+            return {T{} , first , parse_status::invalid};
+        }
+        if(result.ec == std::errc::result_out_of_range)
+        {
+            return {T{} , result.ptr , parse_status::out_of_range};
+        }
+        return {value , result.ptr , parse_status::ok};
+    }
+
+    template<typename T>
+    parse_result<T> parse(const char *first , const char *last) noexcept
+    {
+        static_assert(is_text_convertible_v<T> , "parse needs a non-bool integral or floating point type");
+        return parse_helper<T>(first , last , category_of_t<T>{});
+    }
+
+}
+
+#endif // __NUMERIC_TEXT_H__
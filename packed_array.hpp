@@ -0,0 +1,186 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           packed_array.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file contains the definition of a fixed-size array of unsigned values stored in exactly
+ *                Bits bits each, packed back to back in 64-bit words.
+ *
+ **************************************************************************************************************/
+
+#ifndef __PACKED_ARRAY_H__
+#define __PACKED_ARRAY_H__
+
+#include <cstring>
+
+#include "integer_width.hpp"
+
+namespace traits
+{
+    /******************************************************************************
+     * Class: packed_array
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This class stores n values of Bits bits each in ceil(n * Bits / 64) words.
+     *   -Values may straddle two words. One spare word is kept at the end so reads
+     *    never need a bounds check.
+     *   -get/set access single values, unpack/pack convert a run of values to and from a
+     *    buffer of value_type while walking the words sequentially.
+     *   -Values are truncated to their low Bits bits when stored.
+     *
+     * Template Parameters:
+     *   -Bits : The number of bits of each value, from 1 to 64.
+     *
+     *****************************************************************************/
+    template<size_t Bits>
+    class packed_array
+    {
+        static_assert(Bits > 0 && Bits <= 64 , "packed_array needs between 1 and 64 bits per value");
+
+    public:
+        using value_type = uint_for_bits_t<Bits>;
+
+        using word_type = unsigned long long;
+
+        static constexpr size_t bits = Bits;
+
+        static constexpr size_t word_bits = bit_width_of_v<word_type>;
+
+        static constexpr word_type mask = Bits == word_bits ? ~word_type{0} : (word_type{1} << Bits) - 1;
+
+        packed_array() noexcept = default;
+
+        explicit packed_array(size_t size) : size_(size) , words_(new word_type[word_count(size)]())
+        {
+        }
+
+        packed_array(const packed_array &other) : packed_array(other.size_)
+        {
+            std::memcpy(words_ , other.words_ , word_count(size_) * sizeof(word_type));
+        }
+
+        packed_array(packed_array &&other) noexcept : size_(other.size_) , words_(other.words_)
+        {
+            other.size_ = 0;
+            other.words_ = nullptr;
+        }
+
+        packed_array &operator=(packed_array other) noexcept
+        {
+            swap(other);
+            return *this;
+        }
+
+        ~packed_array()
+        {
+            delete[] words_;
+        }
+
+        void swap(packed_array &other) noexcept
+        {
+            const size_t size = size_;
+            size_ = other.size_;
+            other.size_ = size;
+
+            word_type *words = words_;
+            words_ = other.words_;
+            other.words_ = words;
+        }
+
+        size_t size() const noexcept { return size_; }
+
+        /* Description:
+         * The number of bytes used by the packed storage.
+         */
+        size_t memory_size() const noexcept { return size_ == 0 ? 0 : word_count(size_) * sizeof(word_type); }
+
+        const word_type *words() const noexcept { return words_; }
+
+        value_type get(size_t index) const noexcept
+        {
+            const size_t bit = index * Bits;
+            return read(bit / word_bits , bit % word_bits);
+        }
+
+        void set(size_t index , value_type value) noexcept
+        {
+            const size_t bit = index * Bits;
+            write(bit / word_bits , bit % word_bits , value);
+        }
+
+        /* Description:
+         * Copies count values starting at first into out.
+         */
+        void unpack(size_t first , size_t count , value_type *out) const noexcept
+        {
+            size_t word = first * Bits / word_bits;
+            size_t offset = first * Bits % word_bits;
+
+            for(size_t i = 0 ; i < count ; ++i)
+            {
+                out[i] = read(word , offset);
+                advance(word , offset);
+            }
+        }
+
+        /* Description:
+         * Stores count values from in, starting at position first.
+         */
+        void pack(size_t first , size_t count , const value_type *in) noexcept
+        {
+            size_t word = first * Bits / word_bits;
+            size_t offset = first * Bits % word_bits;
+
+            for(size_t i = 0 ; i < count ; ++i)
+            {
+                write(word , offset , in[i]);
+                advance(word , offset);
+            }
+        }
+
+    private:
+        static constexpr size_t word_count(size_t size) noexcept
+        {
+            return (size * Bits + word_bits - 1) / word_bits + 1;
+        }
+
+        static void advance(size_t &word , size_t &offset) noexcept
+        {
+            offset += Bits;
+            if(offset >= word_bits)
+            {
+                offset -= word_bits;
+                ++word;
+            }
+        }
+
+        value_type read(size_t word , size_t offset) const noexcept
+        {
+            word_type value = words_[word] >> offset;
+            if(offset + Bits > word_bits)
+            {
+                value |= words_[word + 1] << (word_bits - offset);
+            }
+            return static_cast<value_type>(value & mask);
+        }
+
+        void write(size_t word , size_t offset , value_type value) noexcept
+        {
+            const word_type bits_value = static_cast<word_type>(value) & mask;
+
+            words_[word] = (words_[word] & ~(mask << offset)) | (bits_value << offset);
+            if(offset + Bits > word_bits)
+            {
+                const size_t shift = word_bits - offset;
+                words_[word + 1] = (words_[word + 1] & ~(mask >> shift)) | (bits_value >> shift);
+            }
+        }
+
+        size_t size_ = 0;
+        word_type *words_ = nullptr;
+    };
+
+}
+
+#endif // __PACKED_ARRAY_H__
@@ -0,0 +1,280 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           packed_tuple.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file contains the definition of a tuple that stores its elements sorted by decreasing
+ *                alignment, which removes all the padding between them, and of the metafunctions that
+ *                measure the padding a given declaration order costs.
+ *
+ **************************************************************************************************************/
+
+#ifndef __PACKED_TUPLE_H__
+#define __PACKED_TUPLE_H__
+
+#include <utility>
+
+#include "type_list.hpp"
+#include "qualifier.hpp"
+
+namespace traits
+{
+    /******************************************************************************
+     * Metafunction: declared_size, optimal_size, layout_waste
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -declared_size returns the sizeof of a struct holding Ts... in declaration order.
+     *   -optimal_size returns the smallest sizeof any order of Ts... can reach: the sum of
+     *    the sizes, rounded up to the largest alignment (and at least 1).
+     *   -layout_waste returns the bytes the declaration order loses, declared_size - optimal_size,
+     *    so static_assert(layout_waste_v<Ts...> == 0) checks that a layout is already optimal.
+     *
+     * Template Parameters:
+     *   -...Ts : The member types.
+     *
+     *****************************************************************************/
+    constexpr size_t round_up_to(size_t value , size_t alignment) noexcept
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    template<typename ...Ts>
+    constexpr size_t declared_size_helper() noexcept
+    {
+        constexpr size_t sizes[] = {sizeof(Ts)... , 0};
+        constexpr size_t alignments[] = {alignof(Ts)... , 1};
+
+        size_t offset = 0;
+        size_t max_alignment = 1;
+        for(size_t i = 0 ; i < sizeof...(Ts) ; ++i)
+        {
+            offset = round_up_to(offset , alignments[i]) + sizes[i];
+            max_alignment = alignments[i] > max_alignment ? alignments[i] : max_alignment;
+        }
+        return offset == 0 ? 1 : round_up_to(offset , max_alignment);
+    }
+
+    template<typename ...Ts>
+    constexpr size_t optimal_size_helper() noexcept
+    {
+        constexpr size_t sizes[] = {sizeof(Ts)... , 0};
+        constexpr size_t alignments[] = {alignof(Ts)... , 1};
+
+        size_t total = 0;
+        size_t max_alignment = 1;
+        for(size_t i = 0 ; i < sizeof...(Ts) ; ++i)
+        {
+            total += sizes[i];
+            max_alignment = alignments[i] > max_alignment ? alignments[i] : max_alignment;
+        }
+        return total == 0 ? 1 : round_up_to(total , max_alignment);
+    }
+
+    template<typename ...Ts>
+    struct declared_size : integral_constant<size_t , declared_size_helper<Ts...>()>{};
+
+    template<typename ...Ts>
+    static constexpr size_t declared_size_v = declared_size<Ts...>::value;
+
+    template<typename ...Ts>
+    struct optimal_size : integral_constant<size_t , optimal_size_helper<Ts...>()>{};
+
+    template<typename ...Ts>
+    static constexpr size_t optimal_size_v = optimal_size<Ts...>::value;
+
+    template<typename ...Ts>
+    struct layout_waste : integral_constant<size_t , declared_size_v<Ts...> - optimal_size_v<Ts...>>{};
+
+    template<typename ...Ts>
+    static constexpr size_t layout_waste_v = layout_waste<Ts...>::value;
+
+    /******************************************************************************
+     * Metafunction: packed_order
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -packed_order returns the original indices of Ts... sorted by decreasing alignment,
+     *    then by decreasing size, keeping the declaration order of equal elements.
+     *   -Laid out in that order, every element starts at a multiple of its alignment
+     *    (each size being a multiple of its alignment), so only the tail is padded.
+     *   -packed_slot returns the inverse: the position in the sorted layout of the element
+     *    declared at index I.
+     *
+     * Template Parameters:
+     *   -...Ts : The member types.
+     *
+     *****************************************************************************/
+    template<typename ...Ts>
+    constexpr position_array<sizeof...(Ts)> packed_order() noexcept
+    {
+        constexpr size_t sizes[] = {sizeof(Ts)... , 0};
+        constexpr size_t alignments[] = {alignof(Ts)... , 1};
+
+        position_array<sizeof...(Ts)> order{};
+        order.count = sizeof...(Ts);
+        for(size_t i = 0 ; i < sizeof...(Ts) ; ++i)
+        {
+            order.values[i] = i;
+        }
+
+        for(size_t i = 1 ; i < sizeof...(Ts) ; ++i)
+        {
+            for(size_t j = i ; j > 0 ; --j)
+            {
+                const size_t current = order.values[j];
+                const size_t previous = order.values[j - 1];
+                const bool before = alignments[current] > alignments[previous] ||
+                                    (alignments[current] == alignments[previous] && sizes[current] > sizes[previous]);
+                if(!before)
+                {
+                    break;
+                }
+                order.values[j] = previous;
+                order.values[j - 1] = current;
+            }
+        }
+        return order;
+    }
+
+    template<size_t I , typename ...Ts>
+    constexpr size_t packed_slot() noexcept
+    {
+        constexpr position_array<sizeof...(Ts)> order = packed_order<Ts...>();
+
+        size_t slot = 0;
+        while(order.values[slot] != I)
+        {
+            ++slot;
+        }
+        return slot;
+    }
+
+    /******************************************************************************
+     * Class: packed_tuple
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This class is a tuple whose elements are stored in packed_order, so its sizeof
+     *    is optimal_size_v<Ts...>.
+     *   -Elements keep their declared indices: get<I> goes through packed_slot, which is
+     *    resolved at compile time, so the reordering costs nothing at run time.
+     *   -Constructor arguments are also given in declaration order.
+     *   -It supports structured bindings.
+     *
+     * Template Parameters:
+     *   -...Ts : The element types, in declaration order.
+     *
+     *****************************************************************************/
+    template<size_t Slot , typename T>
+    struct packed_tuple_element
+    {
+        packed_tuple_element() : value()
+        {
+        }
+
+        template<typename U>
+        explicit packed_tuple_element(U &&argument) : value(static_cast<U &&>(argument))
+        {
+        }
+
+        T value;
+    };
+
+    template<size_t I , typename U>
+    struct argument_ref
+    {
+        U &&ref;
+    };
+
+    template<typename Indices , typename ...Us>
+    struct argument_pack;
+
+    template<size_t ...Is , typename ...Us>
+    struct argument_pack<index_sequence<Is...> , Us...> : argument_ref<Is , Us>...{};
+
+    template<size_t I , typename U>
+    U &&pick_argument(const argument_ref<I , U> &argument) noexcept
+    {
+        return static_cast<U &&>(argument.ref);
+    }
+
+    template<typename Slots , typename ...Ts>
+    class packed_tuple_impl;
+
+    template<typename ...Ts>
+    using packed_tuple = packed_tuple_impl<make_index_sequence<sizeof...(Ts)> , Ts...>;
+
+    template<size_t ...Slots , typename ...Ts>
+    class packed_tuple_impl<index_sequence<Slots...> , Ts...>
+        : private packed_tuple_element<Slots , at_t<type_list<Ts...> , packed_order<Ts...>().values[Slots]>>...
+    {
+        template<size_t Slot>
+        using slot_t = packed_tuple_element<Slot , at_t<type_list<Ts...> , packed_order<Ts...>().values[Slot]>>;
+
+    public:
+        template<size_t I>
+        using element_t = at_t<type_list<Ts...> , I>;
+
+        static constexpr size_t size = sizeof...(Ts);
+
+        packed_tuple_impl() = default;
+
+        template<typename ...Us , typename = enable_if_t<And<sizeof...(Us) == sizeof...(Ts) ,
+                                                               !is_same_v<remove_cvref_t<Us> , packed_tuple_impl>...>::value , void>>
+        explicit packed_tuple_impl(Us &&...arguments)
+            : slot_t<Slots>(pick_argument<packed_order<Ts...>().values[Slots]>(
+                  argument_pack<make_index_sequence<sizeof...(Us)> , Us...>{{static_cast<Us &&>(arguments)}...}))...
+        {
+        }
+
+        template<size_t I>
+        element_t<I> &get() & noexcept
+        {
+            return static_cast<slot_t<packed_slot<I , Ts...>()> &>(*this).value;
+        }
+
+        template<size_t I>
+        const element_t<I> &get() const & noexcept
+        {
+            return static_cast<const slot_t<packed_slot<I , Ts...>()> &>(*this).value;
+        }
+
+        template<size_t I>
+        element_t<I> &&get() && noexcept
+        {
+            return static_cast<element_t<I> &&>(static_cast<slot_t<packed_slot<I , Ts...>()> &>(*this).value);
+        }
+    };
+
+    template<size_t I , typename Slots , typename ...Ts>
+    decltype(auto) get(packed_tuple_impl<Slots , Ts...> &tuple) noexcept
+    {
+        return tuple.template get<I>();
+    }
+
+    template<size_t I , typename Slots , typename ...Ts>
+    decltype(auto) get(const packed_tuple_impl<Slots , Ts...> &tuple) noexcept
+    {
+        return tuple.template get<I>();
+    }
+
+    template<size_t I , typename Slots , typename ...Ts>
+    decltype(auto) get(packed_tuple_impl<Slots , Ts...> &&tuple) noexcept
+    {
+        return static_cast<packed_tuple_impl<Slots , Ts...> &&>(tuple).template get<I>();
+    }
+
+}
+
+namespace std
+{
+    template<typename Slots , typename ...Ts>
+    struct tuple_size<traits::packed_tuple_impl<Slots , Ts...>> : traits::integral_constant<size_t , sizeof...(Ts)>{};
+
+    template<size_t I , typename Slots , typename ...Ts>
+    struct tuple_element<I , traits::packed_tuple_impl<Slots , Ts...>>
+    {
+        using type = traits::at_t<traits::type_list<Ts...> , I>;
+    };
+}
+
+#endif // __PACKED_TUPLE_H__
@@ -0,0 +1,304 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           parallel.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file contains the definition of parallel versions of for_each, transform and reduce.
+ *                The execution policy is selected at compile time from the type of the range: contiguous
+ *                containers are split into chunks run on several threads, with a chunk size derived from
+ *                the element type, and other ranges are walked sequentially.
+ *
+ **************************************************************************************************************/
+
+#ifndef __PARALLEL_H__
+#define __PARALLEL_H__
+
+#include <atomic>
+#include <exception>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "cache_line.hpp"
+
+namespace traits
+{
+    /******************************************************************************
+     * Metafunction: sequential_policy, parallel_policy
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -These metafunctions serve as execution policy tags.
+     *   -sequential_policy runs the loop on the calling thread.
+     *   -parallel_policy<Grain> splits the range into chunks of Grain elements, which threads
+     *    take one at a time from a shared counter, so faster threads take more chunks.
+     *    Each chunk is a plain loop over a pointer range, which the compiler can vectorize.
+     *
+     * Template Parameters:
+     *   -Grain : The number of elements of a chunk.
+     *
+     *****************************************************************************/
+    struct sequential_policy{};
+
+    template<size_t Grain>
+    struct parallel_policy : integral_constant<size_t , Grain>
+    {
+        static_assert(Grain > 0 , "parallel_policy needs a non-zero grain");
+    };
+
+    /******************************************************************************
+     * Metafunction: parallel_grain
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the chunk size used to process elements of a given type.
+     *   -Trivially copyable elements (numbers, PODs) are cheap to process, so a chunk spans
+     *    parallel_chunk_bytes, enough to hide the cost of taking the chunk.
+     *   -Other elements are assumed to be heavyweight, so a chunk spans a single cache line,
+     *    which balances the load while keeping writes of two threads off the same line.
+     *
+     * Template Parameters:
+     *   -T : The element type.
+     *
+     *****************************************************************************/
+    static constexpr size_t parallel_chunk_bytes = 32768;
+
+    template<typename T>
+    struct parallel_grain
+        : integral_constant<size_t , (is_trivially_copyable_v<T> ? parallel_chunk_bytes : cache_line_size_v) / sizeof(T) == 0
+                                     ? 1
+                                     : (is_trivially_copyable_v<T> ? parallel_chunk_bytes : cache_line_size_v) / sizeof(T)>{};
+
+    template<typename T>
+    static constexpr size_t parallel_grain_v = parallel_grain<T>::value;
+
+    /******************************************************************************
+     * Metafunction: execution_policy_of
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the execution policy used for a range.
+     *   -Contiguous containers (std::vector, std::array, std::string, column_span, ...) get
+     *    parallel_policy with the grain of their value type, other ranges get sequential_policy.
+     *
+     * Template Parameters:
+     *   -Range : The range type.
+     *
+     *****************************************************************************/
+    template<typename Range , bool Contiguous = is_contiguous_container_v<remove_cvref_t<Range>>>
+    struct execution_policy_of : type_is<sequential_policy>{};
+
+    template<typename Range>
+    struct execution_policy_of<Range , true> : type_is<parallel_policy<parallel_grain_v<value_type_t<remove_cvref_t<Range>>>>>{};
+
+    template<typename Range>
+    using execution_policy_of_t = typename execution_policy_of<Range>::type;
+
+    /******************************************************************************
+     * Function: parallel_chunks
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function calls body(first, last, chunk) for every chunk of [0, count).
+     *   -The calling thread works too, along with up to hardware_concurrency - 1 threads
+     *    started for the call, and no more threads than chunks are used.
+     *   -If body throws, the remaining chunks are skipped and the first exception is rethrown
+     *    once every thread has stopped.
+     *
+     *****************************************************************************/
+    template<typename Body>
+    void parallel_chunks(size_t count , size_t grain , Body &body)
+    {
+        const size_t chunk_count = (count + grain - 1) / grain;
+
+        size_t thread_count = std::thread::hardware_concurrency();
+        thread_count = thread_count == 0 ? 1 : thread_count;
+        thread_count = thread_count < chunk_count ? thread_count : chunk_count;
+
+        std::atomic<size_t> next_chunk{0};
+        std::atomic<bool> failed{false};
+        std::exception_ptr error;
+
+        auto worker = [&]()
+        {
+            try
+            {
+                for(size_t chunk = next_chunk.fetch_add(1 , std::memory_order_relaxed) ; chunk < chunk_count ;
+                    chunk = next_chunk.fetch_add(1 , std::memory_order_relaxed))
+                {
+                    const size_t first = chunk * grain;
+                    body(first , count - first < grain ? count : first + grain , chunk);
+                }
+            }
+            catch(...)
+            {
+                if(!failed.exchange(true))
+                {
+                    error = std::current_exception();
+                }
+                next_chunk.store(chunk_count , std::memory_order_relaxed);
+            }
+        };
+
+        std::vector<std::thread> threads;
+        try
+        {
+            threads.reserve(thread_count - 1);
+            for(size_t i = 1 ; i < thread_count ; ++i)
+            {
+                threads.emplace_back(worker);
+            }
+        }
+        catch(...)
+        {
+            // Not enough threads: the chunks are shared among the ones that did start.
+        }
+
+        worker();
+        for(std::thread &thread : threads)
+        {
+            thread.join();
+        }
+
+        if(error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    /******************************************************************************
+     * Function: parallel_for_each
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function calls f on every element of a range.
+     *   -With parallel_policy the calls run concurrently in an unspecified order,
+     *    so f must be safe to call from several threads on distinct elements.
+     *   -The policy defaults to execution_policy_of_t<Range>.
+     *
+     *****************************************************************************/
+    template<typename Range , typename F>
+    void parallel_for_each(sequential_policy , Range &&range , F f)
+    {
+        for(auto &&element : range)
+        {
+            f(element);
+        }
+    }
+
+    template<size_t Grain , typename Range , typename F>
+    void parallel_for_each(parallel_policy<Grain> , Range &&range , F f)
+    {
+        auto *data = range.data();
+        auto body = [data , &f](size_t first , size_t last , size_t)
+        {
+            for(size_t i = first ; i < last ; ++i)
+            {
+                f(data[i]);
+            }
+        };
+        parallel_chunks(range.size() , Grain , body);
+    }
+
+    template<typename Range , typename F>
+    void parallel_for_each(Range &&range , F f)
+    {
+        traits::parallel_for_each(execution_policy_of_t<Range>{} , static_cast<Range &&>(range) , static_cast<F &&>(f));
+    }
+
+    /******************************************************************************
+     * Function: parallel_transform
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function writes f(input[i]) to output[i] for every element of input.
+     *   -output must already hold at least as many elements as input.
+     *   -The policy defaults to the one of the input, and parallel_policy needs
+     *    the output to be a contiguous container too.
+     *
+     *****************************************************************************/
+    template<typename Input , typename Output , typename F>
+    void parallel_transform(sequential_policy , const Input &input , Output &output , F f)
+    {
+        auto out = output.begin();
+        for(const auto &element : input)
+        {
+            *out = f(element);
+            ++out;
+        }
+    }
+
+    template<size_t Grain , typename Input , typename Output , typename F>
+    void parallel_transform(parallel_policy<Grain> , const Input &input , Output &output , F f)
+    {
+        static_assert(is_contiguous_container_v<Output> , "parallel_transform needs a contiguous output");
+
+        const auto *in = input.data();
+        auto *out = output.data();
+        auto body = [in , out , &f](size_t first , size_t last , size_t)
+        {
+            for(size_t i = first ; i < last ; ++i)
+            {
+                out[i] = f(in[i]);
+            }
+        };
+        parallel_chunks(input.size() , Grain , body);
+    }
+
+    template<typename Input , typename Output , typename F>
+    void parallel_transform(const Input &input , Output &output , F f)
+    {
+        traits::parallel_transform(execution_policy_of_t<Input>{} , input , output , static_cast<F &&>(f));
+    }
+
+    /******************************************************************************
+     * Function: parallel_reduce
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function folds the elements of a range with op, starting from init.
+     *   -op must be associative, and the elements must be convertible to T.
+     *   -With parallel_policy every chunk is folded separately, then init and the chunk results
+     *    are folded in chunk order. The grouping only depends on the size of the range and on
+     *    the grain, so floating point results don't change from one run to the next.
+     *   -The policy defaults to execution_policy_of_t<Range>.
+     *
+     *****************************************************************************/
+    template<typename Range , typename T , typename Op>
+    T parallel_reduce(sequential_policy , const Range &range , T init , Op op)
+    {
+        for(const auto &element : range)
+        {
+            init = op(static_cast<T &&>(init) , element);
+        }
+        return init;
+    }
+
+    template<size_t Grain , typename Range , typename T , typename Op>
+    T parallel_reduce(parallel_policy<Grain> , const Range &range , T init , Op op)
+    {
+        const size_t count = range.size();
+        std::vector<std::optional<T>> partials((count + Grain - 1) / Grain);
+
+        const auto *data = range.data();
+        auto body = [data , &op , &partials](size_t first , size_t last , size_t chunk)
+        {
+            T partial = static_cast<T>(data[first]);
+            for(size_t i = first + 1 ; i < last ; ++i)
+            {
+                partial = op(static_cast<T &&>(partial) , data[i]);
+            }
+            partials[chunk].emplace(static_cast<T &&>(partial));
+        };
+        parallel_chunks(count , Grain , body);
+
+        for(std::optional<T> &partial : partials)
+        {
+            init = op(static_cast<T &&>(init) , static_cast<T &&>(*partial));
+        }
+        return init;
+    }
+
+    template<typename Range , typename T , typename Op>
+    T parallel_reduce(const Range &range , T init , Op op)
+    {
+        return traits::parallel_reduce(execution_policy_of_t<Range>{} , range , static_cast<T &&>(init) , static_cast<Op &&>(op));
+    }
+
+}
+
+#endif // __PARALLEL_H__
@@ -25,6 +25,13 @@ namespace traits
      *   -T : The type to remove the const qualifier from.
      *
      *****************************************************************************/
+#if TRAITS_HAS_BUILTIN(__remove_const)
+    template<typename T>
+    struct remove_const : type_is<__remove_const(T)>{};
+
+    template<typename T>
+    using remove_const_t = __remove_const(T);
+#else
     template<typename T>
     struct remove_const : type_is<T>{};
 
@@ -33,6 +40,7 @@ namespace traits
 
     template<typename T>
     using remove_const_t = typename remove_const<T>::type;
+#endif
 
     /******************************************************************************
      * Metafunction: remove_volatile
@@ -44,6 +52,13 @@ namespace traits
      *   -T : The type to remove the volatile qualifier from.
      *
      *****************************************************************************/
+#if TRAITS_HAS_BUILTIN(__remove_volatile)
+    template<typename T>
+    struct remove_volatile : type_is<__remove_volatile(T)>{};
+
+    template<typename T>
+    using remove_volatile_t = __remove_volatile(T);
+#else
     template<typename T>
     struct remove_volatile : type_is<T>{};
 
@@ -52,6 +67,7 @@ namespace traits
 
     template<typename T>
     using remove_volatile_t = typename remove_volatile<T>::type;
+#endif
 
     /******************************************************************************
      * Metafunction: remove_cv
@@ -63,11 +79,19 @@ namespace traits
      *   -T : The type to remove the const and volatile qualifiers from.
      *
      *****************************************************************************/
+#if TRAITS_HAS_BUILTIN(__remove_cv)
+    template<typename T>
+    struct remove_cv : type_is<__remove_cv(T)>{};
+
+    template<typename T>
+    using remove_cv_t = __remove_cv(T);
+#else
     template<typename T>
     struct remove_cv : type_is<remove_const_t<remove_volatile_t<T>>>{};
 
     template<typename T>
     using remove_cv_t = typename remove_cv<T>::type; 
+#endif
 
     /******************************************************************************
      * Metafunction: add_const
@@ -117,6 +141,53 @@ namespace traits
     template<typename T>
     using add_cv_t = typename add_cv<T>::type;
 
+    /******************************************************************************
+     * Metafunction: remove_reference
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction removes the lvalue or rvalue reference from a type.
+     *
+     * Template Parameters:
+     *   -T : The type to remove the reference from.
+     *
+     *****************************************************************************/
+#if TRAITS_HAS_BUILTIN(__remove_reference)
+    template<typename T>
+    struct remove_reference : type_is<__remove_reference(T)>{};
+
+    template<typename T>
+    using remove_reference_t = __remove_reference(T);
+#else
+    template<typename T>
+    struct remove_reference : type_is<T>{};
+
+    template<typename T>
+    struct remove_reference<T&> : type_is<T>{};
+
+    template<typename T>
+    struct remove_reference<T&&> : type_is<T>{};
+
+    template<typename T>
+    using remove_reference_t = typename remove_reference<T>::type;
+#endif
+
+    /******************************************************************************
+     * Metafunction: remove_cvref
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction removes the reference then the const and volatile qualifiers from a type.
+     *   -It is mostly used on the deduced type of a forwarding reference.
+     *
+     * Template Parameters:
+     *   -T : The type to remove the reference and the qualifiers from.
+     *
+     *****************************************************************************/
+    template<typename T>
+    struct remove_cvref : type_is<remove_cv_t<remove_reference_t<T>>>{};
+
+    template<typename T>
+    using remove_cvref_t = typename remove_cvref<T>::type;
+
 }
 
 #endif // __QUALIFIER_H__
@@ -0,0 +1,193 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           reflection.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file contains the definition of compile-time reflection helpers that need neither RTTI
+ *                nor code written per type: the name of a type, taken from the signature the compiler
+ *                prints for a function template, and the fields of an aggregate, counted by brace
+ *                initialization and visited through structured bindings.
+ *
+ **************************************************************************************************************/
+
+#ifndef __REFLECTION_H__
+#define __REFLECTION_H__
+
+#include <string_view>
+
+#include "sequence.hpp"
+#include "type_detector.hpp"
+
+namespace traits
+{
+    /******************************************************************************
+     * Function: type_name
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function returns the name of a type as spelled by the compiler, for instance
+     *    "int", "const char*" or "std::vector<int>" (the exact spelling depends on the compiler).
+     *   -It is computed at compile time from __PRETTY_FUNCTION__ (__FUNCSIG__ with MSVC):
+     *    the text around the name is measured once on void and cut off.
+     *   -The returned view points to static storage, it never dangles.
+     *
+     * Template Parameters:
+     *   -T : The type to name.
+     *
+     *****************************************************************************/
+    template<typename T>
+    constexpr std::string_view function_signature_of() noexcept
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        return __FUNCSIG__;
+#else
+        return __PRETTY_FUNCTION__;
+#endif
+    }
+
+    static constexpr size_t type_name_prefix_size = function_signature_of<void>().find("void");
+
+    static constexpr size_t type_name_suffix_size = function_signature_of<void>().size() - type_name_prefix_size - 4;
+
+    template<typename T>
+    constexpr std::string_view type_name() noexcept
+    {
+        constexpr std::string_view signature = function_signature_of<T>();
+        return signature.substr(type_name_prefix_size , signature.size() - type_name_prefix_size - type_name_suffix_size);
+    }
+
+    /******************************************************************************
+     * Metafunction: is_aggregate
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns true if a given type is an aggregate (an array, or a class
+     *    without user-declared constructors, private fields or virtual functions).
+     *   -It needs the compiler builtin. Without it, every class and array is assumed to be one.
+     *
+     * Template Parameters:
+     *   -T : The type to check whether it's an aggregate or not.
+     *
+     *****************************************************************************/
+#if TRAITS_HAS_BUILTIN(__is_aggregate)
+    template<typename T>
+    struct is_aggregate : bool_constant<__is_aggregate(T)>{};
+#else
+    template<typename T>
+    struct is_aggregate : Or<is_class_v<T> , is_array_v<T>>{};
+#endif
+
+    template<typename T>
+    static constexpr bool is_aggregate_v = is_aggregate<T>::value;
+
+    /******************************************************************************
+     * Metafunction: field_count
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the number of fields of an aggregate class.
+     *   -It is the largest N for which T{a1, ..., aN} is valid, where every ai converts to any type.
+     *   -Fields that are C arrays, and base classes, are not supported: brace elision and
+     *    base initialization make the count differ from the number of fields.
+     *   -It looks for at most max_field_count fields.
+     *
+     * Template Parameters:
+     *   -T : The aggregate type.
+     *
+     *****************************************************************************/
+    static constexpr size_t max_field_count = 64;
+
+    template<size_t I>
+    struct any_field
+    {
+        template<typename U>
+        constexpr operator U() const noexcept;
+    };
+
+    template<typename T , typename Indices , typename = void>
+    struct is_brace_constructible_with : false_type{};
+
+    template<typename T , size_t ...Is>
+    struct is_brace_constructible_with<T , index_sequence<Is...> , void_t<decltype(T{any_field<Is>{}...})>> : true_type{};
+
+    template<typename T , size_t ...Ns>
+    constexpr size_t field_count_helper(index_sequence<Ns...>) noexcept
+    {
+        constexpr bool constructible[] = {is_brace_constructible_with<T , make_index_sequence<Ns>>::value...};
+
+        size_t count = sizeof...(Ns) - 1;
+        while(count > 0 && !constructible[count])
+        {
+            --count;
+        }
+        return count;
+    }
+
+    template<typename T>
+    struct field_count : integral_constant<size_t , field_count_helper<T>(make_index_sequence<max_field_count + 1>{})>
+    {
+        static_assert(is_aggregate_v<T> && is_class_v<T> , "field_count needs an aggregate class");
+    };
+
+    template<typename T>
+    static constexpr size_t field_count_v = field_count<T>::value;
+
+    /******************************************************************************
+     * Function: for_each_field
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function calls f on every field of an aggregate, in declaration order.
+     *   -The fields are reached through a structured binding, so they keep the constness of
+     *    the object, and the same limits as field_count apply.
+     *   -Aggregates of up to 16 fields are supported, bit-fields are not.
+     *
+     *****************************************************************************/
+    template<typename F , typename ...Fields>
+    constexpr void apply_to_fields(F &f , Fields &...fields)
+    {
+        (f(fields) , ...);
+    }
+
+    template<typename T , typename F>
+    constexpr void for_each_field_helper(T & , F & , integral_constant<size_t , 0>)
+    {
+    }
+
+// One overload per field count, each binding the fields to the listed names.
+#define TRAITS_FOR_EACH_FIELD(COUNT , ...)                                                      \
+    template<typename T , typename F>                                                           \
+    constexpr void for_each_field_helper(T &object , F &f , integral_constant<size_t , COUNT>)  \
+    {                                                                                           \
+        auto &[__VA_ARGS__] = object;                                                           \
+        apply_to_fields(f , __VA_ARGS__);                                                       \
+    }
+
+    TRAITS_FOR_EACH_FIELD(1 , a1)
+    TRAITS_FOR_EACH_FIELD(2 , a1 , a2)
+    TRAITS_FOR_EACH_FIELD(3 , a1 , a2 , a3)
+    TRAITS_FOR_EACH_FIELD(4 , a1 , a2 , a3 , a4)
+    TRAITS_FOR_EACH_FIELD(5 , a1 , a2 , a3 , a4 , a5)
+    TRAITS_FOR_EACH_FIELD(6 , a1 , a2 , a3 , a4 , a5 , a6)
+    TRAITS_FOR_EACH_FIELD(7 , a1 , a2 , a3 , a4 , a5 , a6 , a7)
+    TRAITS_FOR_EACH_FIELD(8 , a1 , a2 , a3 , a4 , a5 , a6 , a7 , a8)
+    TRAITS_FOR_EACH_FIELD(9 , a1 , a2 , a3 , a4 , a5 , a6 , a7 , a8 , a9)
+    TRAITS_FOR_EACH_FIELD(10 , a1 , a2 , a3 , a4 , a5 , a6 , a7 , a8 , a9 , a10)
+    TRAITS_FOR_EACH_FIELD(11 , a1 , a2 , a3 , a4 , a5 , a6 , a7 , a8 , a9 , a10 , a11)
+    TRAITS_FOR_EACH_FIELD(12 , a1 , a2 , a3 , a4 , a5 , a6 , a7 , a8 , a9 , a10 , a11 , a12)
+    TRAITS_FOR_EACH_FIELD(13 , a1 , a2 , a3 , a4 , a5 , a6 , a7 , a8 , a9 , a10 , a11 , a12 , a13)
+    TRAITS_FOR_EACH_FIELD(14 , a1 , a2 , a3 , a4 , a5 , a6 , a7 , a8 , a9 , a10 , a11 , a12 , a13 , a14)
+    TRAITS_FOR_EACH_FIELD(15 , a1 , a2 , a3 , a4 , a5 , a6 , a7 , a8 , a9 , a10 , a11 , a12 , a13 , a14 , a15)
+    TRAITS_FOR_EACH_FIELD(16 , a1 , a2 , a3 , a4 , a5 , a6 , a7 , a8 , a9 , a10 , a11 , a12 , a13 , a14 , a15 , a16)
+
+#undef TRAITS_FOR_EACH_FIELD
+
+    template<typename T , typename F>
+    constexpr void for_each_field(T &object , F &&f)
+    {
+        constexpr size_t count = field_count_v<remove_cv_t<T>>;
+        static_assert(count <= 16 , "for_each_field supports aggregates of up to 16 fields");
+
+        for_each_field_helper(object , f , integral_constant<size_t , count>{});
+    }
+
+}
+
+#endif // __REFLECTION_H__
@@ -0,0 +1,200 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           relocation.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file contains the definition of the relocation traits and of the algorithms that
+ *                copy, move and relocate ranges into uninitialized storage.
+ *                The algorithms are dispatched on the traits: eligible types are handled with a single
+ *                memcpy/memmove, and the others fall back to per-element construction.
+ *
+ **************************************************************************************************************/
+
+#ifndef __RELOCATION_H__
+#define __RELOCATION_H__
+
+#include <cstring>
+#include <new>
+
+#include "type_detector.hpp"
+
+namespace traits
+{
+    /******************************************************************************
+     * Metafunction: is_trivially_relocatable
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns true if moving an object to a new address and destroying
+     *    the old one is equivalent to copying its bytes.
+     *   -It is true by default for types that are trivially copyable and trivially destructible.
+     *   -It is an opt-in trait: types that only own resources through pointers (buffers, handles, ...)
+     *    can be marked as relocatable by specializing it.
+     *
+     * Template Parameters:
+     *   -T : The type to check whether it's trivially relocatable or not.
+     *
+     *****************************************************************************/
+    template<typename T>
+    struct is_trivially_relocatable : And<is_trivially_copyable_v<T> , is_trivially_destructible_v<T>>{};
+
+    template<typename T>
+    static constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+    /******************************************************************************
+     * Function: destroy_n
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function destroys n objects starting at first.
+     *   -It does nothing for trivially destructible types.
+     *
+     *****************************************************************************/
+    template<typename T>
+    void destroy_n_helper(T * , size_t , true_type) noexcept
+    {
+    }
+
+    template<typename T>
+    void destroy_n_helper(T *first , size_t n , false_type) noexcept
+    {
+        for(size_t i = 0 ; i < n ; ++i)
+        {
+            first[i].~T();
+        }
+    }
+
+    template<typename T>
+    void destroy_n(T *first , size_t n) noexcept
+    {
+        destroy_n_helper(first , n , is_trivially_destructible<T>{});
+    }
+
+    /******************************************************************************
+     * Function: uninitialized_copy_n
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function copy-constructs n objects from first into the uninitialized storage at dest.
+     *   -Trivially copyable types are copied with a single memcpy.
+     *   -Otherwise the objects are copied one by one, and the ones already constructed
+     *    are destroyed if a copy throws.
+     *   -The two ranges must not overlap.
+     *   -It returns a pointer past the last constructed object.
+     *
+     *****************************************************************************/
+    template<typename T>
+    T *uninitialized_copy_n_helper(const T *first , size_t n , T *dest , true_type) noexcept
+    {
+        if(n != 0)
+        {
+            std::memcpy(static_cast<void *>(dest) , static_cast<const void *>(first) , n * sizeof(T));
+        }
+        return dest + n;
+    }
+
+    template<typename T>
+    T *uninitialized_copy_n_helper(const T *first , size_t n , T *dest , false_type)
+    {
+        size_t i = 0;
+        try
+        {
+            for(; i < n ; ++i)
+            {
+                ::new(static_cast<void *>(dest + i)) T(first[i]);
+            }
+        }
+        catch(...)
+        {
+            traits::destroy_n(dest , i);
+            throw;
+        }
+        return dest + n;
+    }
+
+    template<typename T>
+    T *uninitialized_copy_n(const T *first , size_t n , T *dest)
+    {
+        return uninitialized_copy_n_helper(first , n , dest , is_trivially_copyable<T>{});
+    }
+
+    /******************************************************************************
+     * Function: uninitialized_move_n
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function move-constructs n objects from first into the uninitialized storage at dest.
+     *   -Trivially copyable types are copied with a single memcpy.
+     *   -Otherwise the objects are moved one by one, and the ones already constructed
+     *    are destroyed if a move throws.
+     *   -The source objects are left in their moved-from state, the two ranges must not overlap.
+     *   -It returns a pointer past the last constructed object.
+     *
+     *****************************************************************************/
+    template<typename T>
+    T *uninitialized_move_n_helper(T *first , size_t n , T *dest , true_type) noexcept
+    {
+        return uninitialized_copy_n_helper(static_cast<const T *>(first) , n , dest , true_type{});
+    }
+
+    template<typename T>
+    T *uninitialized_move_n_helper(T *first , size_t n , T *dest , false_type)
+    {
+        size_t i = 0;
+        try
+        {
+            for(; i < n ; ++i)
+            {
+                ::new(static_cast<void *>(dest + i)) T(static_cast<T &&>(first[i]));
+            }
+        }
+        catch(...)
+        {
+            traits::destroy_n(dest , i);
+            throw;
+        }
+        return dest + n;
+    }
+
+    template<typename T>
+    T *uninitialized_move_n(T *first , size_t n , T *dest)
+    {
+        return uninitialized_move_n_helper(first , n , dest , is_trivially_copyable<T>{});
+    }
+
+    /******************************************************************************
+     * Function: relocate
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function moves n objects from first into the uninitialized storage at dest,
+     *    then destroys the source objects, so the source storage becomes uninitialized.
+     *   -Trivially relocatable types are moved with a single memmove, so the two ranges
+     *    may overlap (shifting elements inside a buffer).
+     *   -Otherwise the objects are moved one by one then destroyed, and the ranges must not overlap.
+     *   -It returns a pointer past the last relocated object.
+     *
+     *****************************************************************************/
+    template<typename T>
+    T *relocate_helper(T *first , size_t n , T *dest , true_type) noexcept
+    {
+        if(n != 0)
+        {
+            std::memmove(static_cast<void *>(dest) , static_cast<const void *>(first) , n * sizeof(T));
+        }
+        return dest + n;
+    }
+
+    template<typename T>
+    T *relocate_helper(T *first , size_t n , T *dest , false_type)
+    {
+        T *last = traits::uninitialized_move_n(first , n , dest);
+        traits::destroy_n(first , n);
+        return last;
+    }
+
+    template<typename T>
+    T *relocate(T *first , size_t n , T *dest)
+    {
+        return relocate_helper(first , n , dest , is_trivially_relocatable<T>{});
+    }
+
+}
+
+#endif // __RELOCATION_H__
@@ -0,0 +1,144 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           sequence.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file contains the definition of compile-time integer sequences and of the helpers
+ *                that unroll loops over them (static_for, static_for_each).
+ *
+ **************************************************************************************************************/
+
+#ifndef __SEQUENCE_H__
+#define __SEQUENCE_H__
+
+#include "basic.hpp"
+
+namespace traits
+{
+    /******************************************************************************
+     * Metafunction: integer_sequence
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction serves as a compile-time sequence of integers.
+     *   -It is never used for its value, only to deduce the pack of integers it carries.
+     *
+     * Template Parameters:
+     *   -T     : The integral type of the elements.
+     *   -...Is : The elements of the sequence.
+     *
+     *****************************************************************************/
+    template<typename T , T ...Is>
+    struct integer_sequence
+    {
+        using value_type = T;
+
+        static constexpr size_t size() noexcept
+        {
+            return sizeof...(Is);
+        }
+    };
+
+    template<size_t ...Is>
+    using index_sequence = integer_sequence<size_t , Is...>;
+
+    /******************************************************************************
+     * Metafunction: make_index_sequence
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction generates the sequence of indices 0, 1, ..., N-1.
+     *   -It splits N in halves and joins the two results, so its instantiation depth is
+     *    logarithmic in N and sequences of tens of thousands of indices compile quickly.
+     *
+     * Template Parameters:
+     *   -N : The number of indices to generate.
+     *
+     *****************************************************************************/
+    template<typename First , typename Second>
+    struct join_index_sequences;
+
+    template<size_t ...Is , size_t ...Js>
+    struct join_index_sequences<index_sequence<Is...> , index_sequence<Js...>>
+        : type_is<index_sequence<Is... , (sizeof...(Is) + Js)...>>{};
+
+    template<size_t N>
+    struct make_index_sequence_helper : join_index_sequences<typename make_index_sequence_helper<N / 2>::type,
+                                                             typename make_index_sequence_helper<N - N / 2>::type>{};
+
+    template<>
+    struct make_index_sequence_helper<0> : type_is<index_sequence<>>{};
+
+    template<>
+    struct make_index_sequence_helper<1> : type_is<index_sequence<0>>{};
+
+    template<size_t N>
+    using make_index_sequence = typename make_index_sequence_helper<N>::type;
+
+    template<typename ...Ts>
+    using index_sequence_for = make_index_sequence<sizeof...(Ts)>;
+
+    /******************************************************************************
+     * Metafunction: make_integer_sequence
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction generates the sequence 0, 1, ..., N-1 of a given integral type.
+     *   -It converts the result of make_index_sequence, so it has the same logarithmic depth.
+     *
+     * Template Parameters:
+     *   -T : The integral type of the elements.
+     *   -N : The number of elements to generate.
+     *
+     *****************************************************************************/
+    template<typename T , typename Indices>
+    struct convert_index_sequence;
+
+    template<typename T , size_t ...Is>
+    struct convert_index_sequence<T , index_sequence<Is...>> : type_is<integer_sequence<T , static_cast<T>(Is)...>>{};
+
+    template<typename T , T N>
+    using make_integer_sequence = typename convert_index_sequence<T , make_index_sequence<static_cast<size_t>(N)>>::type;
+
+    /******************************************************************************
+     * Function: static_for
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function calls f(integral_constant<size_t, I>{}) for every I in 0, 1, ..., N-1.
+     *   -The calls are expanded by a fold expression, so the loop is fully unrolled and
+     *    the index can be used as a constant expression inside f.
+     *
+     * Template Parameters:
+     *   -N : The number of iterations.
+     *
+     *****************************************************************************/
+    template<typename F , size_t ...Is>
+    constexpr void static_for_helper(F &f , index_sequence<Is...>)
+    {
+        (f(integral_constant<size_t , Is>{}) , ...);
+    }
+
+    template<size_t N , typename F>
+    constexpr void static_for(F &&f)
+    {
+        static_for_helper(f , make_index_sequence<N>{});
+    }
+
+    /******************************************************************************
+     * Function: static_for_each
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function calls f(type_is<T>{}) for every type T of a pack, in order.
+     *   -The calls are expanded by a fold expression, so the loop is fully unrolled.
+     *
+     * Template Parameters:
+     *   -...Ts : The types to iterate over.
+     *
+     *****************************************************************************/
+    template<typename ...Ts , typename F>
+    constexpr void static_for_each(F &&f)
+    {
+        (f(type_is<Ts>{}) , ...);
+    }
+
+}
+
+#endif // __SEQUENCE_H__
@@ -0,0 +1,395 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           serialization.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file contains the definition of the byte order traits and of a zero-copy binary
+ *                serialization engine for trivially serializable types.
+ *                Scalars, arrays and contiguous containers of such types are written and read with a
+ *                single memcpy when the wire order is the native one, and are only byte swapped
+ *                when the two orders differ. Arrays written in native order can be read back in place.
+ *
+ *                Wire format:
+ *                  -Scalars and arrays: their elements, back to back, in the wire order.
+ *                  -Contiguous containers: the element count as a 64-bit unsigned integer, the elements,
+ *                   then zero padding up to a multiple of 8 bytes.
+ *
+ **************************************************************************************************************/
+
+#ifndef __SERIALIZATION_H__
+#define __SERIALIZATION_H__
+
+#include <cstdint>
+#include <cstring>
+
+#include "column_span.hpp"
+#include "type_detector.hpp"
+
+namespace traits
+{
+    /******************************************************************************
+     * Metafunction: endian
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This enumeration names the byte orders, native is the byte order of the target.
+     *
+     *****************************************************************************/
+    enum class endian
+    {
+        little,
+        big,
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        native = big
+#else
+        native = little
+#endif
+    };
+
+    /******************************************************************************
+     * Metafunction: is_native_endian
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns true if a byte order is the byte order of the target.
+     *
+     * Template Parameters:
+     *   -Order : The byte order to check.
+     *
+     *****************************************************************************/
+    template<endian Order>
+    struct is_native_endian : bool_constant<Order == endian::native>{};
+
+    template<endian Order>
+    static constexpr bool is_native_endian_v = is_native_endian<Order>::value;
+
+    /******************************************************************************
+     * Metafunction: serialization_element_t
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the scalar type a given type is made of.
+     *   -It strips every array extent and the cv qualifiers (int[4][2] -> int).
+     *
+     * Template Parameters:
+     *   -T : The type to get the scalar type of.
+     *
+     *****************************************************************************/
+    template<typename T>
+    struct serialization_element : remove_cv<T>{};
+
+    template<typename T , size_t N>
+    struct serialization_element<T[N]> : serialization_element<T>{};
+
+    template<typename T>
+    using serialization_element_t = typename serialization_element<T>::type;
+
+    /******************************************************************************
+     * Metafunction: is_trivially_serializable
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns true if the bytes of a given type are its serialized form,
+     *    up to byte order.
+     *   -It is true for the integral and floating point types and for arrays of known bound of them.
+     *
+     * Template Parameters:
+     *   -T : The type to check whether it's trivially serializable or not.
+     *
+     *****************************************************************************/
+    template<typename T>
+    struct is_trivially_serializable : Or<is_integral_v<serialization_element_t<T>> ,
+                                          is_floating_point_v<serialization_element_t<T>>>{};
+
+    template<typename T>
+    struct is_trivially_serializable<T[]> : false_type{};
+
+    template<typename T>
+    static constexpr bool is_trivially_serializable_v = is_trivially_serializable<T>::value;
+
+    /******************************************************************************
+     * Metafunction: needs_byte_swap
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns true if a trivially serializable type must be byte swapped
+     *    to be written in (or read from) a given byte order.
+     *   -Single byte elements never need to be swapped.
+     *
+     * Template Parameters:
+     *   -T     : The trivially serializable type.
+     *   -Order : The wire byte order.
+     *
+     *****************************************************************************/
+    template<typename T , endian Order>
+    struct needs_byte_swap : bool_constant<!is_native_endian_v<Order> && (sizeof(serialization_element_t<T>) > 1)>{};
+
+    template<typename T , endian Order>
+    static constexpr bool needs_byte_swap_v = needs_byte_swap<T , Order>::value;
+
+    /******************************************************************************
+     * Function: byte_swap
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function reverses the bytes of a scalar value.
+     *   -2, 4 and 8 byte values use the compiler builtins when they are available.
+     *
+     *****************************************************************************/
+    template<typename T>
+    T byte_swap(T value) noexcept
+    {
+        static_assert(is_trivially_serializable_v<T> && !is_array_v<T> , "byte_swap needs a scalar type");
+
+        unsigned char bytes[sizeof(T)];
+        std::memcpy(bytes , &value , sizeof(T));
+
+#if TRAITS_HAS_BUILTIN(__builtin_bswap16) && TRAITS_HAS_BUILTIN(__builtin_bswap32) && TRAITS_HAS_BUILTIN(__builtin_bswap64)
+        if(sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)
+        {
+            if(sizeof(T) == 2)
+            {
+                std::uint16_t word;
+                std::memcpy(&word , bytes , 2);
+                word = __builtin_bswap16(word);
+                std::memcpy(bytes , &word , 2);
+            }
+            else if(sizeof(T) == 4)
+            {
+                std::uint32_t word;
+                std::memcpy(&word , bytes , 4);
+                word = __builtin_bswap32(word);
+                std::memcpy(bytes , &word , 4);
+            }
+            else
+            {
+                std::uint64_t word;
+                std::memcpy(&word , bytes , 8);
+                word = __builtin_bswap64(word);
+                std::memcpy(bytes , &word , 8);
+            }
+            std::memcpy(&value , bytes , sizeof(T));
+            return value;
+        }
+#endif
+
+        for(size_t i = 0 ; i < sizeof(T) / 2 ; ++i)
+        {
+            unsigned char byte = bytes[i];
+            bytes[i] = bytes[sizeof(T) - 1 - i];
+            bytes[sizeof(T) - 1 - i] = byte;
+        }
+        std::memcpy(&value , bytes , sizeof(T));
+        return value;
+    }
+
+    /******************************************************************************
+     * Function: store, load
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -store writes n scalars to a byte buffer in a given order, load reads them back.
+     *   -When no swap is needed, they are a single memcpy. Otherwise each element is swapped
+     *    on its way in or out.
+     *   -They return a pointer past the bytes written or read.
+     *
+     *****************************************************************************/
+    template<typename T>
+    unsigned char *store_helper(unsigned char *out , const T *first , size_t n , false_type) noexcept
+    {
+        if(n != 0)
+        {
+            std::memcpy(out , first , n * sizeof(T));
+        }
+        return out + n * sizeof(T);
+    }
+
+    template<typename T>
+    unsigned char *store_helper(unsigned char *out , const T *first , size_t n , true_type) noexcept
+    {
+        for(size_t i = 0 ; i < n ; ++i)
+        {
+            const T swapped = byte_swap(first[i]);
+            std::memcpy(out + i * sizeof(T) , &swapped , sizeof(T));
+        }
+        return out + n * sizeof(T);
+    }
+
+    template<endian Order , typename T>
+    unsigned char *store(unsigned char *out , const T *first , size_t n) noexcept
+    {
+        return store_helper(out , first , n , needs_byte_swap<T , Order>{});
+    }
+
+    template<typename T>
+    const unsigned char *load_helper(const unsigned char *in , T *first , size_t n , false_type) noexcept
+    {
+        if(n != 0)
+        {
+            std::memcpy(first , in , n * sizeof(T));
+        }
+        return in + n * sizeof(T);
+    }
+
+    template<typename T>
+    const unsigned char *load_helper(const unsigned char *in , T *first , size_t n , true_type) noexcept
+    {
+        for(size_t i = 0 ; i < n ; ++i)
+        {
+            std::memcpy(first + i , in + i * sizeof(T) , sizeof(T));
+            first[i] = byte_swap(first[i]);
+        }
+        return in + n * sizeof(T);
+    }
+
+    template<endian Order , typename T>
+    const unsigned char *load(const unsigned char *in , T *first , size_t n) noexcept
+    {
+        return load_helper(in , first , n , needs_byte_swap<T , Order>{});
+    }
+
+    /******************************************************************************
+     * Function: serialized_size
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function returns the number of bytes serialize writes for a given value.
+     *
+     *****************************************************************************/
+    static constexpr size_t serialization_alignment = 8;
+
+    constexpr size_t serialization_padding(size_t bytes) noexcept
+    {
+        return (serialization_alignment - bytes % serialization_alignment) % serialization_alignment;
+    }
+
+    template<typename T>
+    constexpr size_t serialized_size_helper(const T & , true_type) noexcept
+    {
+        return sizeof(T);
+    }
+
+    template<typename C>
+    size_t serialized_size_helper(const C &container , false_type) noexcept
+    {
+        const size_t payload = container.size() * sizeof(value_type_t<C>);
+        return sizeof(std::uint64_t) + payload + serialization_padding(payload);
+    }
+
+    template<typename T>
+    size_t serialized_size(const T &value) noexcept
+    {
+        return serialized_size_helper(value , is_trivially_serializable<T>{});
+    }
+
+    /******************************************************************************
+     * Function: serialize
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function writes a value to a byte buffer in a given wire order (little endian
+     *    by default), and returns a pointer past the written bytes.
+     *   -The value is a trivially serializable scalar or array, or a contiguous container of
+     *    trivially serializable elements, whose elements are written in one block.
+     *   -The buffer must hold at least serialized_size(value) bytes.
+     *
+     *****************************************************************************/
+    template<endian Order , typename T>
+    unsigned char *serialize_helper(unsigned char *out , const T &value , true_type) noexcept
+    {
+        using element = serialization_element_t<T>;
+
+        return traits::store<Order>(out , reinterpret_cast<const element *>(&value) , sizeof(T) / sizeof(element));
+    }
+
+    template<endian Order , typename C>
+    unsigned char *serialize_helper(unsigned char *out , const C &container , false_type) noexcept
+    {
+        static_assert(is_contiguous_container_v<C> && is_trivially_serializable_v<value_type_t<C>> ,
+                      "serialize needs a trivially serializable value or a contiguous container of them");
+
+        const std::uint64_t count = container.size();
+        out = traits::store<Order>(out , &count , 1);
+        out = traits::store<Order>(out ,
+                                   reinterpret_cast<const serialization_element_t<value_type_t<C>> *>(container.data()) ,
+                                   container.size() * (sizeof(value_type_t<C>) / sizeof(serialization_element_t<value_type_t<C>>)));
+
+        const size_t padding = serialization_padding(container.size() * sizeof(value_type_t<C>));
+        std::memset(out , 0 , padding);
+        return out + padding;
+    }
+
+    template<endian Order = endian::little , typename T>
+    unsigned char *serialize(unsigned char *out , const T &value) noexcept
+    {
+        return serialize_helper<Order>(out , value , is_trivially_serializable<T>{});
+    }
+
+    /******************************************************************************
+     * Function: deserialize
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function reads a value written by serialize with the same wire order, and
+     *    returns a pointer past the read bytes.
+     *   -Containers are resized to the stored count, then filled in one block.
+     *
+     *****************************************************************************/
+    template<endian Order , typename T>
+    const unsigned char *deserialize_helper(const unsigned char *in , T &value , true_type) noexcept
+    {
+        using element = serialization_element_t<T>;
+
+        return traits::load<Order>(in , reinterpret_cast<element *>(&value) , sizeof(T) / sizeof(element));
+    }
+
+    template<endian Order , typename C>
+    const unsigned char *deserialize_helper(const unsigned char *in , C &container , false_type)
+    {
+        static_assert(is_contiguous_container_v<C> && is_trivially_serializable_v<value_type_t<C>> ,
+                      "deserialize needs a trivially serializable value or a contiguous container of them");
+
+        using element = serialization_element_t<value_type_t<C>>;
+
+        std::uint64_t count = 0;
+        in = traits::load<Order>(in , &count , 1);
+        container.resize(static_cast<size_t>(count));
+        in = traits::load<Order>(in ,
+                                 reinterpret_cast<element *>(container.data()) ,
+                                 container.size() * (sizeof(value_type_t<C>) / sizeof(element)));
+        return in + serialization_padding(container.size() * sizeof(value_type_t<C>));
+    }
+
+    template<endian Order = endian::little , typename T>
+    const unsigned char *deserialize(const unsigned char *in , T &value)
+    {
+        return deserialize_helper<Order>(in , value , is_trivially_serializable<T>{});
+    }
+
+    /******************************************************************************
+     * Function: deserialize_view
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function reads a container written by serialize without copying its elements:
+     *    the returned view points into the input buffer (a memory-mapped file, ...).
+     *   -It is only available when the wire order is the native one.
+     *   -The elements must be suitably aligned in the buffer. Containers are padded to 8 bytes,
+     *    so this holds for a buffer made of containers starting at an 8-byte aligned address.
+     *    If it doesn't hold, an empty view with a null data pointer is returned and the input
+     *    is not consumed, so the caller can fall back to deserialize.
+     *
+     *****************************************************************************/
+    template<typename T , endian Order = endian::little>
+    const unsigned char *deserialize_view(const unsigned char *in , column_span<const T> &view) noexcept
+    {
+        static_assert(is_trivially_serializable_v<T> , "deserialize_view needs a trivially serializable element type");
+        static_assert(!needs_byte_swap_v<T , Order> , "deserialize_view can't read a non-native byte order in place");
+
+        std::uint64_t count = 0;
+        const unsigned char *elements = traits::load<Order>(in , &count , 1);
+
+        if(reinterpret_cast<std::uintptr_t>(elements) % alignof(T) != 0)
+        {
+            view = column_span<const T>(nullptr , 0);
+            return in;
+        }
+
+        view = column_span<const T>(reinterpret_cast<const T *>(elements) , static_cast<size_t>(count));
+        const size_t payload = static_cast<size_t>(count) * sizeof(T);
+        return elements + payload + serialization_padding(payload);
+    }
+
+}
+
+#endif // __SERIALIZATION_H__
@@ -0,0 +1,145 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           sharded_counter.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file contains the definition of a counter split into per-thread shards, each on its own
+ *                cache line, so that threads updating it concurrently don't contend on a single line.
+ *
+ **************************************************************************************************************/
+
+#ifndef __SHARDED_COUNTER_H__
+#define __SHARDED_COUNTER_H__
+
+#include <atomic>
+#include <thread>
+
+#include "cache_line.hpp"
+#include "dispatch.hpp"
+
+namespace traits
+{
+    /******************************************************************************
+     * Function: this_thread_shard
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function returns a number assigned to the calling thread on its first call.
+     *   -Threads are numbered in the order they first call it, so the first N threads
+     *    land on N different shards of any counter with at least N shards.
+     *
+     *****************************************************************************/
+    inline size_t this_thread_shard() noexcept
+    {
+        static std::atomic<size_t> next_shard{0};
+        thread_local const size_t shard = next_shard.fetch_add(1 , std::memory_order_relaxed);
+        return shard;
+    }
+
+    /******************************************************************************
+     * Class: sharded_counter
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This class is a counter or accumulator that many threads can add to concurrently.
+     *   -It keeps one padded atomic slot per shard, every thread adds to the slot of its shard
+     *    with relaxed ordering, and value() folds the slots.
+     *   -The number of shards is rounded up to a power of two and defaults to the number of
+     *    hardware threads.
+     *   -Integral slots use fetch_add, floating point slots use a compare-exchange loop.
+     *   -value() is not a snapshot: additions running concurrently may or may not be counted.
+     *
+     * Template Parameters:
+     *   -T : The type of the counter, an integral or floating point type with lock-free atomics.
+     *
+     *****************************************************************************/
+    template<typename T>
+    class sharded_counter
+    {
+        static_assert(is_numeric_v<T> && !is_same_v<T , bool> , "sharded_counter needs an integral or floating point type");
+        static_assert(is_lock_free_atomic_v<T> , "sharded_counter needs a type with lock-free atomics");
+
+    public:
+        using value_type = T;
+
+        explicit sharded_counter(size_t shard_count = std::thread::hardware_concurrency())
+            : mask_(round_up_to_power_of_two(shard_count) - 1) , slots_(new slot[mask_ + 1])
+        {
+        }
+
+        sharded_counter(const sharded_counter &) = delete;
+        sharded_counter &operator=(const sharded_counter &) = delete;
+
+        ~sharded_counter()
+        {
+            delete[] slots_;
+        }
+
+        void add(T delta) noexcept
+        {
+            add_helper(slots_[this_thread_shard() & mask_].value , delta , category_of_t<T>{});
+        }
+
+        void increment() noexcept
+        {
+            add(T{1});
+        }
+
+        sharded_counter &operator+=(T delta) noexcept
+        {
+            add(delta);
+            return *this;
+        }
+
+        T value() const noexcept
+        {
+            T result{};
+            for(size_t i = 0 ; i <= mask_ ; ++i)
+            {
+                result += slots_[i].value.load(std::memory_order_relaxed);
+            }
+            return result;
+        }
+
+        void reset() noexcept
+        {
+            for(size_t i = 0 ; i <= mask_ ; ++i)
+            {
+                slots_[i].value.store(T{} , std::memory_order_relaxed);
+            }
+        }
+
+        size_t shard_count() const noexcept { return mask_ + 1; }
+
+    private:
+        using slot = padded<std::atomic<T>>;
+
+        static size_t round_up_to_power_of_two(size_t count) noexcept
+        {
+            size_t result = 1;
+            while(result < count)
+            {
+                result *= 2;
+            }
+            return result;
+        }
+
+        static void add_helper(std::atomic<T> &slot_value , T delta , integral_tag) noexcept
+        {
+            slot_value.fetch_add(delta , std::memory_order_relaxed);
+        }
+
+        static void add_helper(std::atomic<T> &slot_value , T delta , floating_point_tag) noexcept
+        {
+            T expected = slot_value.load(std::memory_order_relaxed);
+            while(!slot_value.compare_exchange_weak(expected , expected + delta , std::memory_order_relaxed))
+            {
+            }
+        }
+
+        size_t mask_;
+        slot *slots_;
+    };
+
+}
+
+#endif // __SHARDED_COUNTER_H__
@@ -0,0 +1,254 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           simd.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file contains the definition of the SIMD eligibility traits and of a small set of
+ *                algorithms (transform, reduce, fill) that are dispatched on them.
+ *                Vectorizable element types are processed in blocks as wide as a register of the
+ *                target instruction set, other types go through plain scalar loops.
+ *
+ **************************************************************************************************************/
+
+#ifndef __SIMD_H__
+#define __SIMD_H__
+
+#include <cstring>
+
+#include "type_detector.hpp"
+
+namespace traits
+{
+namespace simd
+{
+    /******************************************************************************
+     * Metafunction: scalar, sse2, avx2, avx512
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -These metafunctions serve as tags for the supported instruction sets.
+     *   -Each one holds the width of its vector registers in bytes.
+     *
+     *****************************************************************************/
+    struct scalar : integral_constant<size_t , 0>{};
+
+    struct sse2 : integral_constant<size_t , 16>{};
+
+    struct avx2 : integral_constant<size_t , 32>{};
+
+    struct avx512 : integral_constant<size_t , 64>{};
+
+    /******************************************************************************
+     * Metafunction: native_isa
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the widest instruction set enabled for the current compilation
+     *    (-msse2, -mavx2, -mavx512f, ...).
+     *
+     *****************************************************************************/
+#if defined(__AVX512F__)
+    using native_isa = avx512;
+#elif defined(__AVX2__)
+    using native_isa = avx2;
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    using native_isa = sse2;
+#else
+    using native_isa = scalar;
+#endif
+
+    /******************************************************************************
+     * Metafunction: is_simd_vectorizable
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns true if a given type can be held in the lanes of a vector register.
+     *   -It is true for the numeric types except bool and long double.
+     *
+     * Template Parameters:
+     *   -T : The element type.
+     *
+     *****************************************************************************/
+    template<typename T>
+    struct is_simd_vectorizable : bool_constant<is_numeric_v<T> &&
+                                                !is_same_raw_v<T , bool> &&
+                                                !is_same_raw_v<T , long double>>{};
+
+    template<typename T>
+    static constexpr bool is_simd_vectorizable_v = is_simd_vectorizable<T>::value;
+
+    /******************************************************************************
+     * Metafunction: simd_width
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the number of elements of a given type processed per
+     *    vector register of an instruction set.
+     *   -It returns 1 for types that are not vectorizable and for the scalar instruction set.
+     *
+     * Template Parameters:
+     *   -T   : The element type.
+     *   -ISA : The instruction set tag, it defaults to the native one.
+     *
+     *****************************************************************************/
+    template<typename T , typename ISA = native_isa>
+    struct simd_width : integral_constant<size_t , (is_simd_vectorizable_v<T> && ISA::value > sizeof(T))
+                                                   ? ISA::value / sizeof(T)
+                                                   : 1>{};
+
+    template<typename T , typename ISA = native_isa>
+    static constexpr size_t simd_width_v = simd_width<T , ISA>::value;
+
+    /******************************************************************************
+     * Function: transform
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function stores f(first[i]) into out[i] for the n elements starting at first.
+     *   -Vectorizable types are processed in blocks of simd_width elements, so the inner
+     *    loop has a constant trip count and maps onto a single vector operation.
+     *   -It returns a pointer past the last written element.
+     *
+     *****************************************************************************/
+    template<typename T , typename U , typename F>
+    U *transform_helper(const T *first , size_t n , U *out , F &f , false_type)
+    {
+        for(size_t i = 0 ; i < n ; ++i)
+        {
+            out[i] = f(first[i]);
+        }
+        return out + n;
+    }
+
+    template<typename T , typename U , typename F>
+    U *transform_helper(const T *first , size_t n , U *out , F &f , true_type)
+    {
+        constexpr size_t width = simd_width_v<T>;
+
+        size_t i = 0;
+        for(; i + width <= n ; i += width)
+        {
+            for(size_t lane = 0 ; lane < width ; ++lane)
+            {
+                out[i + lane] = f(first[i + lane]);
+            }
+        }
+        return transform_helper(first + i , n - i , out + i , f , false_type{});
+    }
+
+    template<typename T , typename U , typename F>
+    U *transform(const T *first , size_t n , U *out , F f)
+    {
+        return transform_helper(first , n , out , f , is_simd_vectorizable<T>{});
+    }
+
+    /******************************************************************************
+     * Function: reduce
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function folds the n elements starting at first into init using op.
+     *   -Vectorizable types keep one accumulator per lane and combine them at the end,
+     *    which breaks the loop-carried dependency of a plain accumulation.
+     *   -The operation must be associative and commutative. The elements are combined
+     *    in a different order than a scalar loop would, so floating point results
+     *    may differ in rounding.
+     *
+     *****************************************************************************/
+    template<typename T , typename Op>
+    T reduce_helper(const T *first , size_t n , T init , Op &op , false_type)
+    {
+        for(size_t i = 0 ; i < n ; ++i)
+        {
+            init = op(init , first[i]);
+        }
+        return init;
+    }
+
+    template<typename T , typename Op>
+    T reduce_helper(const T *first , size_t n , T init , Op &op , true_type)
+    {
+        constexpr size_t width = simd_width_v<T>;
+
+        if(n < width)
+        {
+            return reduce_helper(first , n , init , op , false_type{});
+        }
+
+        T lanes[width];
+        for(size_t lane = 0 ; lane < width ; ++lane)
+        {
+            lanes[lane] = first[lane];
+        }
+
+        size_t i = width;
+        for(; i + width <= n ; i += width)
+        {
+            for(size_t lane = 0 ; lane < width ; ++lane)
+            {
+                lanes[lane] = op(lanes[lane] , first[i + lane]);
+            }
+        }
+
+        for(size_t lane = 0 ; lane < width ; ++lane)
+        {
+            init = op(init , lanes[lane]);
+        }
+        return reduce_helper(first + i , n - i , init , op , false_type{});
+    }
+
+    template<typename T , typename Op>
+    T reduce(const T *first , size_t n , T init , Op op)
+    {
+        return reduce_helper(first , n , init , op , is_simd_vectorizable<T>{});
+    }
+
+    /******************************************************************************
+     * Function: fill
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function assigns value to the n elements starting at first.
+     *   -Single byte vectorizable types are filled with memset, wider ones are filled
+     *    in blocks of simd_width elements.
+     *
+     *****************************************************************************/
+    template<typename T>
+    void fill_helper(T *first , size_t n , const T &value , false_type)
+    {
+        for(size_t i = 0 ; i < n ; ++i)
+        {
+            first[i] = value;
+        }
+    }
+
+    template<typename T>
+    void fill_helper(T *first , size_t n , const T &value , true_type)
+    {
+        constexpr size_t width = simd_width_v<T>;
+
+        if(sizeof(T) == 1)
+        {
+            if(n != 0)
+            {
+                std::memset(first , static_cast<unsigned char>(value) , n);
+            }
+            return;
+        }
+
+        const T copy = value;
+        size_t i = 0;
+        for(; i + width <= n ; i += width)
+        {
+            for(size_t lane = 0 ; lane < width ; ++lane)
+            {
+                first[i + lane] = copy;
+            }
+        }
+        fill_helper(first + i , n - i , copy , false_type{});
+    }
+
+    template<typename T>
+    void fill(T *first , size_t n , const T &value)
+    {
+        fill_helper(first , n , value , is_simd_vectorizable<T>{});
+    }
+
+}
+}
+
+#endif // __SIMD_H__
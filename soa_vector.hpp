@@ -0,0 +1,301 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           soa_vector.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file contains the definition of a struct-of-arrays container generated from a pack of
+ *                field types. Every field is stored in its own contiguous, aligned array, so scanning one
+ *                field only touches the cache lines holding that field.
+ *
+ **************************************************************************************************************/
+
+#ifndef __SOA_VECTOR_H__
+#define __SOA_VECTOR_H__
+
+#include <new>
+
+#include "column_span.hpp"
+#include "type_list.hpp"
+#include "relocation.hpp"
+
+namespace traits
+{
+    /******************************************************************************
+     * Class: soa_column
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This class holds the storage of one field of a soa_vector.
+     *   -The index makes every column a distinct base, even when two fields share a type.
+     *
+     *****************************************************************************/
+    template<size_t I , typename T>
+    struct soa_column
+    {
+        T *data = nullptr;
+    };
+
+    /******************************************************************************
+     * Class: soa_vector
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This class is a growable sequence of records whose fields are stored column by column.
+     *   -Each column is allocated separately and aligned to soa_column_alignment, and columns
+     *    are grown with relocate, so trivially relocatable fields are moved with a single memmove.
+     *   -Fields are accessed by index (column<0>()) or, when the type appears once, by type
+     *    (column<float>()). operator[] returns a proxy referring to one record.
+     *
+     * Template Parameters:
+     *   -...Ts : The field types, in declaration order.
+     *
+     *****************************************************************************/
+    static constexpr size_t soa_column_alignment = 64;
+
+    template<typename Indices , typename ...Ts>
+    class soa_vector_impl;
+
+    template<typename ...Ts>
+    using soa_vector = soa_vector_impl<make_index_sequence<sizeof...(Ts)> , Ts...>;
+
+    template<size_t ...Is , typename ...Ts>
+    class soa_vector_impl<index_sequence<Is...> , Ts...> : private soa_column<Is , Ts>...
+    {
+        static_assert(sizeof...(Ts) > 0 , "soa_vector needs at least one field");
+
+    public:
+        template<size_t I>
+        using field_t = at_t<type_list<Ts...> , I>;
+
+        template<typename T>
+        static constexpr size_t field_index_v = index_of_in_pack_v<T , Ts...>;
+
+        /* Description:
+         * A proxy referring to one record, its fields are reached with get<I>() or get<T>().
+         */
+        template<bool Const>
+        class basic_reference
+        {
+            using owner_type = if_type_t<Const , const soa_vector_impl , soa_vector_impl>;
+
+        public:
+            basic_reference(owner_type *owner , size_t index) noexcept : owner_(owner) , index_(index){}
+
+            template<size_t I>
+            decltype(auto) get() const noexcept
+            {
+                return owner_->template column<I>()[index_];
+            }
+
+            template<typename T>
+            decltype(auto) get() const noexcept
+            {
+                return get<field_index_v<T>>();
+            }
+
+        private:
+            owner_type *owner_;
+            size_t index_;
+        };
+
+        using reference = basic_reference<false>;
+
+        using const_reference = basic_reference<true>;
+
+        soa_vector_impl() noexcept = default;
+
+        soa_vector_impl(const soa_vector_impl &other) : soa_vector_impl()
+        {
+            reserve(other.size_);
+            (traits::uninitialized_copy_n(other.data_of<Is , Ts>() , other.size_ , data_of<Is , Ts>()) , ...);
+            size_ = other.size_;
+        }
+
+        soa_vector_impl(soa_vector_impl &&other) noexcept
+            : soa_column<Is , Ts>(other.column_of<Is , Ts>())... , size_(other.size_) , capacity_(other.capacity_)
+        {
+            ((other.column_of<Is , Ts>().data = nullptr) , ...);
+            other.size_ = 0;
+            other.capacity_ = 0;
+        }
+
+        soa_vector_impl &operator=(soa_vector_impl other) noexcept
+        {
+            swap(other);
+            return *this;
+        }
+
+        ~soa_vector_impl()
+        {
+            clear();
+            (deallocate_column(data_of<Is , Ts>()) , ...);
+        }
+
+        void swap(soa_vector_impl &other) noexcept
+        {
+            (swap_values(column_of<Is , Ts>().data , other.column_of<Is , Ts>().data) , ...);
+            swap_values(size_ , other.size_);
+            swap_values(capacity_ , other.capacity_);
+        }
+
+        size_t size() const noexcept { return size_; }
+
+        size_t capacity() const noexcept { return capacity_; }
+
+        bool empty() const noexcept { return size_ == 0; }
+
+        /* Description:
+         * Returns a view over the column of the I-th field.
+         */
+        template<size_t I>
+        column_span<field_t<I>> column() noexcept
+        {
+            return {data_of<I , field_t<I>>() , size_};
+        }
+
+        template<size_t I>
+        column_span<const field_t<I>> column() const noexcept
+        {
+            return {data_of<I , field_t<I>>() , size_};
+        }
+
+        /* Description:
+         * Returns a view over the column of the first field of type T.
+         */
+        template<typename T>
+        column_span<T> column() noexcept
+        {
+            static_assert(is_in_pack_v<T , Ts...> , "T is not a field of this soa_vector");
+            return column<field_index_v<T>>();
+        }
+
+        template<typename T>
+        column_span<const T> column() const noexcept
+        {
+            static_assert(is_in_pack_v<T , Ts...> , "T is not a field of this soa_vector");
+            return column<field_index_v<T>>();
+        }
+
+        reference operator[](size_t index) noexcept { return {this , index}; }
+
+        const_reference operator[](size_t index) const noexcept { return {this , index}; }
+
+        /* Description:
+         * Grows every column so that it can hold at least new_capacity records.
+         */
+        void reserve(size_t new_capacity)
+        {
+            if(new_capacity <= capacity_)
+            {
+                return;
+            }
+
+            void *columns[] = {allocate_column<Ts>(new_capacity)...};
+            bool complete = true;
+            for(void *column : columns)
+            {
+                complete = complete && column != nullptr;
+            }
+            if(!complete)
+            {
+                (deallocate_column(static_cast<Ts *>(columns[Is])) , ...);
+                throw std::bad_alloc{};
+            }
+
+            (relocate_column(column_of<Is , Ts>() , static_cast<Ts *>(columns[Is])) , ...);
+            capacity_ = new_capacity;
+        }
+
+        /* Description:
+         * Appends a record, each argument constructs the field at the same position.
+         */
+        template<typename ...Args>
+        void emplace_back(Args &&...args)
+        {
+            static_assert(sizeof...(Args) == sizeof...(Ts) , "emplace_back needs one argument per field");
+
+            if(size_ == capacity_)
+            {
+                reserve(capacity_ == 0 ? 8 : 2 * capacity_);
+            }
+
+            size_t constructed = 0;
+            try
+            {
+                ((::new(static_cast<void *>(data_of<Is , Ts>() + size_)) Ts(static_cast<Args &&>(args)) , ++constructed) , ...);
+            }
+            catch(...)
+            {
+                ((Is < constructed ? traits::destroy_n(data_of<Is , Ts>() + size_ , 1) : void()) , ...);
+                throw;
+            }
+            ++size_;
+        }
+
+        void push_back(const Ts &...values)
+        {
+            emplace_back(values...);
+        }
+
+        void pop_back() noexcept
+        {
+            --size_;
+            (traits::destroy_n(data_of<Is , Ts>() + size_ , 1) , ...);
+        }
+
+        void clear() noexcept
+        {
+            (traits::destroy_n(data_of<Is , Ts>() , size_) , ...);
+            size_ = 0;
+        }
+
+    private:
+        template<size_t I , typename T>
+        soa_column<I , T> &column_of() noexcept { return *this; }
+
+        template<size_t I , typename T>
+        const soa_column<I , T> &column_of() const noexcept { return *this; }
+
+        template<size_t I , typename T>
+        T *data_of() const noexcept { return static_cast<const soa_column<I , T> &>(*this).data; }
+
+        template<typename T>
+        static constexpr size_t column_alignment() noexcept
+        {
+            return alignof(T) > soa_column_alignment ? alignof(T) : soa_column_alignment;
+        }
+
+        template<typename T>
+        static void *allocate_column(size_t capacity) noexcept
+        {
+            return ::operator new(capacity * sizeof(T) , std::align_val_t(column_alignment<T>()) , std::nothrow);
+        }
+
+        template<typename T>
+        static void deallocate_column(T *data) noexcept
+        {
+            ::operator delete(static_cast<void *>(data) , std::align_val_t(column_alignment<T>()));
+        }
+
+        template<size_t I , typename T>
+        void relocate_column(soa_column<I , T> &column , T *new_data)
+        {
+            traits::relocate(column.data , size_ , new_data);
+            deallocate_column(column.data);
+            column.data = new_data;
+        }
+
+        template<typename T>
+        static void swap_values(T &first , T &second) noexcept
+        {
+            T temp = first;
+            first = second;
+            second = temp;
+        }
+
+        size_t size_ = 0;
+        size_t capacity_ = 0;
+    };
+
+}
+
+#endif // __SOA_VECTOR_H__
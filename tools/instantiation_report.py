@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+"""
+Project:        CppTraits
+File:           instantiation_report.py
+Author:         Hussam Wael
+Date:           17-10-2026
+Description:    Ranks the traits:: metafunctions by the compile time spent instantiating them.
+
+Usage:
+    instantiation_report.py [--top N] [--by-site] [--namespace NS] FILE...
+
+Each FILE is either:
+  - a Clang trace written by -ftime-trace (a .json file). Instantiation events are grouped by
+    metafunction name (the detail up to its first '<'), and both inclusive and self time are reported.
+    Self time excludes the instantiations nested inside an event, so a metafunction that only
+    forwards to another one is not charged twice.
+    With --by-site the events are also split per call site. This is the file:line Clang records when
+    built with -ftime-trace-verbose, otherwise the translation unit the trace belongs to.
+  - the stderr of a GCC build with -ftime-report. GCC only reports per phase, so the tool prints the
+    template instantiation time of each translation unit.
+"""
+
+import argparse
+import json
+import re
+import sys
+from collections import defaultdict
+
+INSTANTIATION_EVENTS = ("InstantiateClass", "InstantiateFunction")
+
+# "<phase> : <usr> (<pct>) <sys> (<pct>) <wall> ...", the percentages are missing on the TOTAL line.
+GCC_PHASE = re.compile(r"^\s*([^:]+?)\s*:\s*[0-9.]+\s*(?:\(\s*\d+%\))?\s*[0-9.]+\s*(?:\(\s*\d+%\))?\s*([0-9.]+)")
+
+
+def metafunction_name(detail):
+    """Returns the name of the template in an instantiation detail, without its arguments."""
+    return detail.split("<", 1)[0].strip()
+
+
+def self_times(events):
+    """Returns (event, self duration) pairs, the duration of nested events being subtracted."""
+    result = []
+    by_thread = defaultdict(list)
+    for event in events:
+        by_thread[event.get("tid", 0)].append(event)
+
+    for thread_events in by_thread.values():
+        thread_events.sort(key=lambda e: (e["ts"], -e["dur"]))
+        stack = []
+        for event in thread_events:
+            end = event["ts"] + event["dur"]
+            while stack and stack[-1][1] <= event["ts"]:
+                stack.pop()
+            if stack:
+                stack[-1][0][1] -= event["dur"]
+            entry = [event, event["dur"]]
+            result.append(entry)
+            stack.append((entry, end))
+
+    return result
+
+
+def read_clang_trace(path, data, namespace, totals, by_site):
+    """Adds the count, inclusive and self time of every instantiation of a trace to totals."""
+    events = [e for e in data.get("traceEvents", [])
+              if e.get("ph") == "X" and e.get("name") in INSTANTIATION_EVENTS and "dur" in e]
+
+    for event, self_duration in self_times(events):
+        args = event.get("args", {})
+        name = metafunction_name(args.get("detail", ""))
+        if not name.startswith(namespace):
+            continue
+
+        site = path
+        if "file" in args:
+            site = "%s:%s" % (args["file"], args.get("line", "?"))
+
+        for key in ((name,), (name, site)) if by_site else ((name,),):
+            stats = totals[key]
+            stats[0] += 1
+            stats[1] += event["dur"]
+            stats[2] += self_duration
+
+
+def read_gcc_report(text):
+    """Returns the wall time of every phase of a -ftime-report output."""
+    phases = {}
+    for line in text.splitlines():
+        match = GCC_PHASE.match(line)
+        if match:
+            phases[match.group(1)] = float(match.group(2))
+    return phases
+
+
+def print_clang_report(totals, top):
+    """Prints the metafunctions by decreasing self time, each followed by its call sites if any."""
+    row = "%10d %12.2f %12.2f  %s"
+    names = sorted((k for k in totals if len(k) == 1), key=lambda k: totals[k][2], reverse=True)
+    if top:
+        names = names[:top]
+
+    print("%10s %12s %12s  %s" % ("count", "self ms", "total ms", "metafunction"))
+    for name in names:
+        count, total, self_duration = totals[name]
+        print(row % (count, self_duration / 1000.0, total / 1000.0, name[0]))
+
+        sites = sorted((k for k in totals if len(k) == 2 and k[0] == name[0]),
+                       key=lambda k: totals[k][2], reverse=True)
+        for site in sites:
+            count, total, self_duration = totals[site]
+            print(row % (count, self_duration / 1000.0, total / 1000.0, "  @ " + site[1]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Rank metafunctions by instantiation time.")
+    parser.add_argument("files", nargs="+", help="-ftime-trace JSON files or -ftime-report outputs")
+    parser.add_argument("--top", type=int, default=30, help="number of rows to print, 0 for all")
+    parser.add_argument("--by-site", action="store_true", help="split every metafunction per call site")
+    parser.add_argument("--namespace", default="traits::", help="only report templates with this prefix")
+    options = parser.parse_args()
+
+    totals = defaultdict(lambda: [0, 0, 0])
+    gcc_reports = []
+
+    for path in options.files:
+        with open(path, encoding="utf-8", errors="replace") as file:
+            text = file.read()
+        try:
+            data = json.loads(text)
+        except ValueError:
+            gcc_reports.append((path, read_gcc_report(text)))
+            continue
+        read_clang_trace(path, data, options.namespace, totals, options.by_site)
+
+    if totals:
+        print_clang_report(totals, options.top)
+
+    if gcc_reports:
+        if totals:
+            print()
+        print("%15s %12s  %s" % ("instantiation s", "total s", "translation unit"))
+        for path, phases in sorted(gcc_reports, key=lambda r: r[1].get("template instantiation", 0.0), reverse=True):
+            print("%15.2f %12.2f  %s" % (phases.get("template instantiation", 0.0), phases.get("TOTAL", 0.0), path))
+
+    if not totals and not gcc_reports:
+        print("no %s instantiation found" % options.namespace, file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
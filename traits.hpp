@@ -0,0 +1,46 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           traits.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file includes every header of the library.
+ *                It is meant to be compiled once, as a precompiled header or a C++20 header unit
+ *                (import "traits.hpp";), so that translation units stop re-parsing the individual headers.
+ *                The individual headers can still be included on their own.
+ *
+ **************************************************************************************************************/
+
+#ifndef __TRAITS_H__
+#define __TRAITS_H__
+
+#include "basic.hpp"
+#include "qualifier.hpp"
+#include "logic.hpp"
+#include "metafunction.hpp"
+#include "type_set.hpp"
+#include "detection.hpp"
+#include "type_detector.hpp"
+#include "concepts.hpp"
+#include "dispatch.hpp"
+#include "sequence.hpp"
+#include "type_list.hpp"
+#include "integer_width.hpp"
+#include "relocation.hpp"
+#include "allocator.hpp"
+#include "arena.hpp"
+#include "column_span.hpp"
+#include "soa_vector.hpp"
+#include "simd.hpp"
+#include "variant.hpp"
+#include "packed_array.hpp"
+#include "packed_tuple.hpp"
+#include "serialization.hpp"
+#include "numeric_text.hpp"
+#include "cache_line.hpp"
+#include "sharded_counter.hpp"
+#include "parallel.hpp"
+#include "function_traits.hpp"
+#include "reflection.hpp"
+
+#endif // __TRAITS_H__
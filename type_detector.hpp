@@ -12,6 +12,8 @@
 #define __TYPE_DETECTOR_H__
 
 #include "logic.hpp"
+#include "type_set.hpp"
+#include "detection.hpp"
 
 namespace traits
 {       
@@ -110,29 +112,30 @@ namespace traits
 	 *-----------------------------------------------------------------------------
 	 * Description:
 	 *   -This metafunction returns true if a given type is integral.
+     *   -The integral types are held in a type_set, so the check is a single overload resolution.
      * 
 	 * Template Parameters:
 	 *   -T : The type to check whether it's integral or not.
 	 *
 	 *****************************************************************************/
-    template<typename T>
-    struct is_integral: is_in_pack<remove_cv_t<T>,
-                                bool,
-                                char,
-                                char16_t,
-                                char32_t,
-                                wchar_t,
-                                unsigned char,
-                                short,
-                                unsigned short,
-                                int,
-                                unsigned int,
-                                long,
-                                unsigned long,
-                                long long,
-                                unsigned long long>{};
-
+    using integral_types = type_set<bool,
+                                    char,
+                                    char16_t,
+                                    char32_t,
+                                    wchar_t,
+                                    signed char,
+                                    unsigned char,
+                                    short,
+                                    unsigned short,
+                                    int,
+                                    unsigned int,
+                                    long,
+                                    unsigned long,
+                                    long long,
+                                    unsigned long long>;
 
+    template<typename T>
+    struct is_integral : set_contains<integral_types , remove_cv_t<T>>{};
 
     template<typename T>
     static constexpr bool is_integral_v = is_integral<T>::value;
@@ -141,18 +144,19 @@ namespace traits
 	 * Metafunction: is_floating_point
 	 *-----------------------------------------------------------------------------
 	 * Description:
-	 *   -This metafunction returns true if a given type is float or double.
+	 *   -This metafunction returns true if a given type is float, double or long double.
+     *   -The floating point types are held in a type_set, so the check is a single overload resolution.
      * 
 	 * Template Parameters:
 	 *   -T : The type to check whether it's floating point or not.
 	 *
 	 *****************************************************************************/
+    using floating_point_types = type_set<float,
+                                          double,
+                                          long double>;
+
     template<typename T>
-    struct is_floating_point : is_in_pack< remove_cv_t<T>,
-                                           float,
-                                           double,
-                                           long double
-                                           >{};
+    struct is_floating_point : set_contains<floating_point_types , remove_cv_t<T>>{};
     
     template<typename T>
     static constexpr bool is_floating_point_v = is_floating_point<T>::value;
@@ -168,7 +172,7 @@ namespace traits
 	 *
 	 *****************************************************************************/
     template<typename T>
-    struct is_numeric : Or<is_integral_v<T> , is_floating_point_v<T>>{};
+    struct is_numeric : disjunction<is_integral<T> , is_floating_point<T>>{};
 
     template<typename T>
     static constexpr bool is_numeric_v = is_numeric<T>::value;
@@ -183,6 +187,13 @@ namespace traits
      * -T : The type to check whether it's an array or not.
      * 
      *****************************************************************************/
+#if TRAITS_HAS_BUILTIN(__is_array)
+    template<typename T>
+    struct is_array : bool_constant<__is_array(T)>{};
+
+    template<typename T>
+    static constexpr bool is_array_v = __is_array(T);
+#else
     template<typename T>
     struct is_array : false_type{};
 
@@ -194,26 +205,41 @@ namespace traits
 
     template<typename T>
     static constexpr bool is_array_v = is_array<T>::value;
+#endif
 
     /******************************************************************************
      * Metafunction: is_function
      * -----------------------------------------------------------------------------
      * Description:
      *  -This metafunction returns true if a given type is a function.
+     *  -Without the builtin, it relies on functions and references being the only types
+     *   that stay unqualified after adding const, so it also detects noexcept, variadic
+     *   and cv/ref-qualified function types.
      * 
      * Template Parameters:
      * -T : The type to check whether it's a function or not.
      * 
      *****************************************************************************/
 
+#if TRAITS_HAS_BUILTIN(__is_function)
     template<typename T>
-    struct is_function : false_type{};
+    struct is_function : bool_constant<__is_function(T)>{};
 
-    template<typename T , typename ...Args>
-    struct is_function<T(Args...)> : true_type{};
+    template<typename T>
+    static constexpr bool is_function_v = __is_function(T);
+#else
+    template<typename T>
+    struct is_const_helper : false_type{};
+
+    template<typename T>
+    struct is_const_helper<const T> : true_type{};
+
+    template<typename T>
+    struct is_function : bool_constant<!is_const_helper<const T>::value && !is_reference_v<T>>{};
 
     template<typename T>
     static constexpr bool is_function_v = is_function<T>{};
+#endif
 
     /******************************************************************************
      * Metafunction: is_class
@@ -221,11 +247,19 @@ namespace traits
      * Description:
      *  -This metafunction returns true if a given type is a class.
      *  -It uses SFINAE and void_t to detect whether a given type is a class or not.
+     *  -Like the SFINAE version, the builtin version also returns true for unions.
      * 
      * Template Parameters:
      * -T : The type to check whether it's a class or not.
      * 
      *****************************************************************************/
+#if TRAITS_HAS_BUILTIN(__is_class) && TRAITS_HAS_BUILTIN(__is_union)
+    template<typename T>
+    struct is_class : bool_constant<__is_class(T) || __is_union(T)>{};
+
+    template<typename T>
+    static constexpr bool is_class_v = __is_class(T) || __is_union(T);
+#else
     template<typename T , typename = void>
     struct is_class : false_type{};
 
@@ -237,27 +271,182 @@ namespace traits
 
     template<typename T>
     static constexpr bool is_class_v = is_class<T>{};
+#endif
+
+
+    /******************************************************************************
+     * Metafunction: value_type_t
+     * -----------------------------------------------------------------------------
+     * Description:
+     *  -This metafunction returns the element type of a container or of an array.
+     *  -For class types, it returns the nested value_type.
+     *  -If the type has no element type, it has no type member, so it can be used with SFINAE.
+     * 
+     * Template Parameters:
+     * -T : The type to get the element type of.
+     * 
+     *****************************************************************************/
+    template<typename T>
+    using member_value_type = typename T::value_type;
+
+    template<typename T , typename = void>
+    struct value_type_of{};
+
+    template<typename T>
+    struct value_type_of<T , void_t<member_value_type<T>>> : type_is<member_value_type<T>>{};
+
+    template<typename T>
+    struct value_type_of<T[] , void> : type_is<T>{};
+
+    template<typename T , size_t N>
+    struct value_type_of<T[N] , void> : type_is<T>{};
+
+    template<typename T>
+    using value_type_t = typename value_type_of<T>::type;
+
+    /******************************************************************************
+     * Metafunction: has_size
+     * -----------------------------------------------------------------------------
+     * Description:
+     *  -This metafunction returns true if a given type has a size() member function.
+     * 
+     * Template Parameters:
+     * -T : The type to check whether it has a size or not.
+     * 
+     *****************************************************************************/
+    template<typename T>
+    using size_expression = decltype(declval<T &>().size());
+
+    template<typename T>
+    struct has_size : is_detected<size_expression , T>{};
+
+    template<typename T>
+    static constexpr bool has_size_v = has_size<T>::value;
+
+    /******************************************************************************
+     * Metafunction: is_range
+     * -----------------------------------------------------------------------------
+     * Description:
+     *  -This metafunction returns true if a given type can be iterated over.
+     *  -It is true for arrays of known bound and for types with begin() and end() member functions.
+     * 
+     * Template Parameters:
+     * -T : The type to check whether it's a range or not.
+     * 
+     *****************************************************************************/
+    template<typename T>
+    using begin_expression = decltype(declval<T &>().begin());
+
+    template<typename T>
+    using end_expression = decltype(declval<T &>().end());
 
+    template<typename T>
+    struct is_range : And<is_detected_v<begin_expression , T> , is_detected_v<end_expression , T>>{};
+
+    template<typename T , size_t N>
+    struct is_range<T[N]> : true_type{};
+
+    template<typename T>
+    static constexpr bool is_range_v = is_range<T>::value;
 
     /******************************************************************************
      * Metafunction: is_container
      * -----------------------------------------------------------------------------
      * Description:
      *  -This metafunction returns true if a given type is a container.
+     *  -It is structural: any class with a value_type and begin()/end() member functions is
+     *   a container (std::vector, std::array, std::string, std::map, spans, ...), whatever the
+     *   shape of its template parameters.
      * 
      * Template Parameters:
      * -T : The type to check whether it's a container or not.
      * 
      *****************************************************************************/
     template<typename T>
-    struct is_container : false_type{};
-
-    template< template<typename, typename> class Container , typename T , typename Allocator>
-    struct is_container<Container<T,Allocator> > : true_type{};
+    struct is_container : And<is_class_v<T> , is_detected_v<value_type_t , T> , is_range_v<T>>{};
 
     template<typename T>
     static constexpr bool is_container_v = is_container<T>::value;
 
+    /******************************************************************************
+     * Metafunction: is_contiguous_container
+     * -----------------------------------------------------------------------------
+     * Description:
+     *  -This metafunction returns true if a given type is a container that stores its elements
+     *   in a single contiguous block.
+     *  -It requires a data() member function returning a pointer to value_type and a size()
+     *   member function, so the elements can be handled as a pointer and a length.
+     * 
+     * Template Parameters:
+     * -T : The type to check whether it's a contiguous container or not.
+     * 
+     *****************************************************************************/
+    template<typename V>
+    true_type points_to(const volatile V *);
+
+    template<typename V>
+    false_type points_to(...);
+
+    template<typename T>
+    using data_points_to_value = decltype(points_to<value_type_t<T>>(declval<T &>().data()));
+
+    template<typename T>
+    struct is_contiguous_container : And<is_container_v<T> ,
+                                         has_size_v<T> ,
+                                         detected_or_t<false_type , data_points_to_value , T>::value>{};
+
+    template<typename T>
+    static constexpr bool is_contiguous_container_v = is_contiguous_container<T>::value;
+
+    /******************************************************************************
+     * Metafunction: is_trivially_copyable
+     * -----------------------------------------------------------------------------
+     * Description:
+     *  -This metafunction returns true if a given type can be copied with memcpy.
+     *  -It uses the compiler builtin when available. Otherwise it conservatively
+     *   returns true for numeric and pointer types only.
+     * 
+     * Template Parameters:
+     * -T : The type to check whether it's trivially copyable or not.
+     * 
+     *****************************************************************************/
+#if TRAITS_HAS_BUILTIN(__is_trivially_copyable)
+    template<typename T>
+    struct is_trivially_copyable : bool_constant<__is_trivially_copyable(T)>{};
+#else
+    template<typename T>
+    struct is_trivially_copyable : Or<is_numeric_v<T> , is_pointer_v<T>>{};
+#endif
+
+    template<typename T>
+    static constexpr bool is_trivially_copyable_v = is_trivially_copyable<T>::value;
+
+    /******************************************************************************
+     * Metafunction: is_trivially_destructible
+     * -----------------------------------------------------------------------------
+     * Description:
+     *  -This metafunction returns true if destroying a given type is a no-op.
+     *  -It uses the compiler builtin when available. Otherwise it conservatively
+     *   returns true for numeric and pointer types only.
+     * 
+     * Template Parameters:
+     * -T : The type to check whether it's trivially destructible or not.
+     * 
+     *****************************************************************************/
+#if TRAITS_HAS_BUILTIN(__is_trivially_destructible)
+    template<typename T>
+    struct is_trivially_destructible : bool_constant<__is_trivially_destructible(T)>{};
+#elif TRAITS_HAS_BUILTIN(__has_trivial_destructor)
+    template<typename T>
+    struct is_trivially_destructible : bool_constant<__has_trivial_destructor(T)>{};
+#else
+    template<typename T>
+    struct is_trivially_destructible : Or<is_numeric_v<T> , is_pointer_v<T>>{};
+#endif
+
+    template<typename T>
+    static constexpr bool is_trivially_destructible_v = is_trivially_destructible<T>::value;
+
 
 }
 
@@ -0,0 +1,286 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           type_list.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file contains the definition of a type list and the algorithms that operate on it.
+ *                Indexing is done through overload resolution against an inherited base pack, and
+ *                filtering/reversing are built on indexing, so none of them recurse once per element.
+ *
+ **************************************************************************************************************/
+
+#ifndef __TYPE_LIST_H__
+#define __TYPE_LIST_H__
+
+#include "basic.hpp"
+#include "logic.hpp"
+#include "sequence.hpp"
+
+namespace traits
+{
+    /******************************************************************************
+     * Metafunction: type_list
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction serves as a compile-time container of types.
+     *   -It is never instantiated, it is only used to carry a pack around.
+     *
+     * Template Parameters:
+     *   -...Ts : The types held by the list.
+     *
+     *****************************************************************************/
+    template<typename ...Ts>
+    struct type_list{};
+
+    /******************************************************************************
+     * Metafunction: size
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the number of types in a type list.
+     *
+     * Template Parameters:
+     *   -List : The type list.
+     *
+     *****************************************************************************/
+    template<typename List>
+    struct size;
+
+    template<typename ...Ts>
+    struct size<type_list<Ts...>> : integral_constant<size_t , sizeof...(Ts)>{};
+
+    template<typename List>
+    static constexpr size_t size_v = size<List>::value;
+
+    /******************************************************************************
+     * Metafunction: at
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the type at a given position in a type list.
+     *   -The list is turned into a class inheriting from one indexed_type per element,
+     *    the requested element is then picked by overload resolution, so the lookup
+     *    has a constant instantiation depth (apart from make_index_sequence, which is logarithmic).
+     *
+     * Template Parameters:
+     *   -List : The type list.
+     *   -I    : The zero-based position, it must be smaller than the size of the list.
+     *
+     *****************************************************************************/
+    template<size_t I , typename T>
+    struct indexed_type : type_is<T>{};
+
+    template<typename List , typename Indices>
+    struct type_list_indexer;
+
+    template<typename ...Ts , size_t ...Is>
+    struct type_list_indexer<type_list<Ts...> , index_sequence<Is...>> : indexed_type<Is , Ts>...{};
+
+    template<size_t I , typename T>
+    type_is<T> select_indexed(const indexed_type<I , T> *);
+
+    template<typename List , size_t I>
+    struct at;
+
+    template<typename ...Ts , size_t I>
+    struct at<type_list<Ts...> , I>
+        : decltype(select_indexed<I>(static_cast<const type_list_indexer<type_list<Ts...> , make_index_sequence<sizeof...(Ts)>> *>(nullptr))){};
+
+    template<typename List , size_t I>
+    using at_t = typename at<List , I>::type;
+
+    /******************************************************************************
+     * Metafunction: index_of
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the position of the first occurrence of a type in a type list.
+     *   -If the type is not in the list, it returns the size of the list.
+     *
+     * Template Parameters:
+     *   -List : The type list.
+     *   -T    : The type to search for.
+     *
+     *****************************************************************************/
+    template<typename List , typename T>
+    struct index_of;
+
+    template<typename ...Ts , typename T>
+    struct index_of<type_list<Ts...> , T> : index_of_in_pack<T , Ts...>{};
+
+    template<typename List , typename T>
+    static constexpr size_t index_of_v = index_of<List , T>::value;
+
+    /******************************************************************************
+     * Metafunction: contains
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns true if a type is in a type list.
+     *
+     * Template Parameters:
+     *   -List : The type list.
+     *   -T    : The type to search for.
+     *
+     *****************************************************************************/
+    template<typename List , typename T>
+    struct contains;
+
+    template<typename ...Ts , typename T>
+    struct contains<type_list<Ts...> , T> : is_in_pack<T , Ts...>{};
+
+    template<typename List , typename T>
+    static constexpr bool contains_v = contains<List , T>::value;
+
+    /******************************************************************************
+     * Metafunction: concat
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction joins any number of type lists into one.
+     *   -Its instantiation depth grows with the number of lists, not with their sizes.
+     *
+     * Template Parameters:
+     *   -...Lists : The type lists to join.
+     *
+     *****************************************************************************/
+    template<typename ...Lists>
+    struct concat : type_is<type_list<>>{};
+
+    template<typename ...Ts>
+    struct concat<type_list<Ts...>> : type_is<type_list<Ts...>>{};
+
+    template<typename ...Ts , typename ...Us , typename ...Lists>
+    struct concat<type_list<Ts...> , type_list<Us...> , Lists...> : concat<type_list<Ts... , Us...> , Lists...>{};
+
+    template<typename ...Lists>
+    using concat_t = typename concat<Lists...>::type;
+
+    /******************************************************************************
+     * Metafunction: select_positions
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This helper metafunction keeps the elements of a type list whose flag is true.
+     *   -The kept positions are computed by a constexpr loop and then looked up with at,
+     *    so it is the common building block of filter and unique.
+     *
+     * Template Parameters:
+     *   -List     : The type list.
+     *   -...keep  : One flag per element of the list.
+     *
+     *****************************************************************************/
+    template<size_t N>
+    struct position_array
+    {
+        size_t values[N + 1];
+        size_t count;
+    };
+
+    template<bool ...keep>
+    constexpr position_array<sizeof...(keep)> kept_positions()
+    {
+        constexpr bool flags[] = {keep... , false};
+
+        position_array<sizeof...(keep)> positions{};
+        for(size_t i = 0 ; i < sizeof...(keep) ; ++i)
+        {
+            if(flags[i])
+            {
+                positions.values[positions.count++] = i;
+            }
+        }
+        return positions;
+    }
+
+    template<typename List , typename Indices , bool ...keep>
+    struct select_positions_helper;
+
+    template<typename ...Ts , size_t ...Js , bool ...keep>
+    struct select_positions_helper<type_list<Ts...> , index_sequence<Js...> , keep...>
+        : type_is<type_list<at_t<type_list<Ts...> , kept_positions<keep...>().values[Js]>...>>{};
+
+    template<typename List , bool ...keep>
+    struct select_positions
+        : select_positions_helper<List , make_index_sequence<kept_positions<keep...>().count> , keep...>{};
+
+    /******************************************************************************
+     * Metafunction: filter
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction keeps the types of a type list that satisfy a predicate.
+     *   -Any value returning metafunction can be used as a predicate (is_numeric, is_pointer, ...).
+     *
+     * Template Parameters:
+     *   -List : The type list.
+     *   -Pred : The predicate, Pred<T>::value is evaluated for each element.
+     *
+     *****************************************************************************/
+    template<typename List , template<typename...> class Pred>
+    struct filter;
+
+    template<typename ...Ts , template<typename...> class Pred>
+    struct filter<type_list<Ts...> , Pred> : select_positions<type_list<Ts...> , bool(Pred<Ts>::value)...>{};
+
+    template<typename List , template<typename...> class Pred>
+    using filter_t = typename filter<List , Pred>::type;
+
+    /******************************************************************************
+     * Metafunction: transform
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction applies a type returning metafunction to every type of a type list.
+     *
+     * Template Parameters:
+     *   -List : The type list.
+     *   -F    : The metafunction, F<T>::type is taken for each element (remove_cv, add_const, ...).
+     *
+     *****************************************************************************/
+    template<typename List , template<typename...> class F>
+    struct transform;
+
+    template<typename ...Ts , template<typename...> class F>
+    struct transform<type_list<Ts...> , F> : type_is<type_list<typename F<Ts>::type...>>{};
+
+    template<typename List , template<typename...> class F>
+    using transform_t = typename transform<List , F>::type;
+
+    /******************************************************************************
+     * Metafunction: unique
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction removes the duplicate types of a type list.
+     *   -The first occurrence of every type is kept, and the relative order is preserved.
+     *
+     * Template Parameters:
+     *   -List : The type list.
+     *
+     *****************************************************************************/
+    template<typename List , typename Indices = make_index_sequence<size_v<List>>>
+    struct unique;
+
+    template<typename ...Ts , size_t ...Is>
+    struct unique<type_list<Ts...> , index_sequence<Is...>>
+        : select_positions<type_list<Ts...> , (index_of_in_pack_v<Ts , Ts...> == Is)...>{};
+
+    template<typename List>
+    using unique_t = typename unique<List>::type;
+
+    /******************************************************************************
+     * Metafunction: reverse
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction reverses the order of the types in a type list.
+     *
+     * Template Parameters:
+     *   -List : The type list.
+     *
+     *****************************************************************************/
+    template<typename List , typename Indices = make_index_sequence<size_v<List>>>
+    struct reverse;
+
+    template<typename ...Ts , size_t ...Is>
+    struct reverse<type_list<Ts...> , index_sequence<Is...>>
+        : type_is<type_list<at_t<type_list<Ts...> , sizeof...(Ts) - 1 - Is>...>>{};
+
+    template<typename List>
+    using reverse_t = typename reverse<List>::type;
+
+}
+
+#endif // __TYPE_LIST_H__
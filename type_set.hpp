@@ -0,0 +1,168 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           type_set.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file contains the definition of a type set and a type map.
+ *                Both inherit from one base per element, and queries are answered by overload
+ *                resolution against those bases, so membership and lookup take a constant number
+ *                of instantiations whatever the size of the set.
+ *
+ **************************************************************************************************************/
+
+#ifndef __TYPE_SET_H__
+#define __TYPE_SET_H__
+
+#include "basic.hpp"
+#include "logic.hpp"
+
+namespace traits
+{
+    /******************************************************************************
+     * Metafunction: type_set
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction serves as a compile-time set of types.
+     *   -It inherits from type_is<T> for every element, so the types must be unique.
+     *
+     * Template Parameters:
+     *   -...Ts : The types held by the set.
+     *
+     *****************************************************************************/
+    template<typename ...Ts>
+    struct type_set : type_is<Ts>...{};
+
+    /******************************************************************************
+     * Metafunction: set_contains
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns true if a type is an element of a type set.
+     *   -A pointer to the set only converts to a pointer to type_is<T> when T is an element,
+     *    otherwise the overload taking const void* is selected.
+     *
+     * Template Parameters:
+     *   -Set : The type set.
+     *   -T   : The type to search for.
+     *
+     *****************************************************************************/
+    template<typename T>
+    true_type set_lookup(const type_is<T> *);
+
+    template<typename T>
+    false_type set_lookup(const void *);
+
+    template<typename Set , typename T>
+    struct set_contains : decltype(set_lookup<T>(static_cast<const Set *>(nullptr))){};
+
+    template<typename Set , typename T>
+    static constexpr bool set_contains_v = set_contains<Set , T>::value;
+
+    /******************************************************************************
+     * Metafunction: pair
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction serves as a key/value entry of a type map.
+     *
+     * Template Parameters:
+     *   -K : The key type.
+     *   -V : The value type.
+     *
+     *****************************************************************************/
+    template<typename K , typename V>
+    struct pair
+    {
+        using first_type = K;
+
+        using second_type = V;
+    };
+
+    /******************************************************************************
+     * Metafunction: type_map
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction serves as a compile-time map from types to types.
+     *   -It inherits from every one of its pairs, so the keys must be unique.
+     *
+     * Template Parameters:
+     *   -...Pairs : The entries of the map, each one is a pair<K,V>.
+     *
+     *****************************************************************************/
+    template<typename ...Pairs>
+    struct type_map;
+
+    template<typename ...Ks , typename ...Vs>
+    struct type_map<pair<Ks , Vs>...> : pair<Ks , Vs>...{};
+
+    /******************************************************************************
+     * Metafunction: map_at
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the value type associated with a key in a type map.
+     *   -The value is deduced from the pair<K,V> base of the map, so the lookup has a constant
+     *    instantiation depth.
+     *   -If the key is not in the map, it has no type member, so it can be used with SFINAE.
+     *
+     * Template Parameters:
+     *   -Map : The type map.
+     *   -K   : The key to look up.
+     *
+     *****************************************************************************/
+    template<typename K , typename V>
+    type_is<V> map_lookup(const pair<K , V> *);
+
+    template<typename Map , typename K , typename = void>
+    struct map_at{};
+
+    template<typename Map , typename K>
+    struct map_at<Map , K , void_t<decltype(map_lookup<K>(static_cast<const Map *>(nullptr)))>>
+        : decltype(map_lookup<K>(static_cast<const Map *>(nullptr))){};
+
+    template<typename Map , typename K>
+    using map_at_t = typename map_at<Map , K>::type;
+
+    /******************************************************************************
+     * Metafunction: map_contains
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns true if a key is in a type map.
+     *
+     * Template Parameters:
+     *   -Map : The type map.
+     *   -K   : The key to search for.
+     *
+     *****************************************************************************/
+    template<typename Map , typename K , typename = void>
+    struct map_contains : false_type{};
+
+    template<typename Map , typename K>
+    struct map_contains<Map , K , void_t<map_at_t<Map , K>>> : true_type{};
+
+    template<typename Map , typename K>
+    static constexpr bool map_contains_v = map_contains<Map , K>::value;
+
+    /******************************************************************************
+     * Metafunction: map_at_or
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the value type associated with a key in a type map,
+     *    or a default type if the key is not in the map.
+     *
+     * Template Parameters:
+     *   -Map     : The type map.
+     *   -K       : The key to look up.
+     *   -Default : The type to return if the key is missing.
+     *
+     *****************************************************************************/
+    template<typename Map , typename K , typename Default , typename = void>
+    struct map_at_or : type_is<Default>{};
+
+    template<typename Map , typename K , typename Default>
+    struct map_at_or<Map , K , Default , void_t<map_at_t<Map , K>>> : map_at<Map , K>{};
+
+    template<typename Map , typename K , typename Default>
+    using map_at_or_t = typename map_at_or<Map , K , Default>::type;
+
+}
+
+#endif // __TYPE_SET_H__
@@ -0,0 +1,472 @@
+/***************************************************************************************************************
+ *
+ *Project:        CppTraits
+ *File:           variant.hpp
+ *Author:         Hussam Wael
+ *Date:           17-10-2026
+ *Description:    This file contains the definition of a lean variant and of the jump-table dispatch it is
+ *                built on. Visiting a variant is a single indirect call through a table of function
+ *                pointers generated from the alternatives, and the index is stored in the smallest
+ *                unsigned type able to hold it.
+ *
+ **************************************************************************************************************/
+
+#ifndef __VARIANT_H__
+#define __VARIANT_H__
+
+#include <new>
+
+#include "integer_width.hpp"
+#include "type_list.hpp"
+#include "relocation.hpp"
+#include "sequence.hpp"
+
+namespace traits
+{
+    /******************************************************************************
+     * Metafunction: type_index_of
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the position of a type in a pack of types.
+     *   -Unlike index_of_in_pack, the type must be in the pack, otherwise compilation fails.
+     *
+     * Template Parameters:
+     *   -T     : The type to search for.
+     *   -...Ts : The pack of types to search in.
+     *
+     *****************************************************************************/
+    template<typename T , typename ...Ts>
+    struct type_index_of : index_of_in_pack<T , Ts...>
+    {
+        static_assert(is_in_pack_v<T , Ts...> , "T is not one of the types of the pack");
+    };
+
+    template<typename T , typename ...Ts>
+    static constexpr size_t type_index_of_v = type_index_of<T , Ts...>::value;
+
+    /******************************************************************************
+     * Function: visit_index
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function calls f(integral_constant<size_t, I>{}) where I is equal to a runtime index.
+     *   -It goes through a static table of N function pointers, one per possible index,
+     *    so the dispatch is a single indirect call whatever N is.
+     *   -All the calls must return the same type, index must be smaller than N.
+     *
+     * Template Parameters:
+     *   -N : The number of possible indices.
+     *
+     *****************************************************************************/
+    template<typename R , typename F , size_t I>
+    R invoke_with_index(F &f)
+    {
+        return f(integral_constant<size_t , I>{});
+    }
+
+    template<typename F , size_t ...Is>
+    decltype(auto) visit_index_helper(size_t index , F &f , index_sequence<Is...>)
+    {
+        using result_type = decltype(f(integral_constant<size_t , 0>{}));
+
+        static constexpr result_type (*table[])(F &) = {&invoke_with_index<result_type , F , Is>...};
+        return table[index](f);
+    }
+
+    template<size_t N , typename F>
+    decltype(auto) visit_index(size_t index , F &&f)
+    {
+        static_assert(N > 0 , "visit_index needs at least one index");
+        return visit_index_helper(index , f , make_index_sequence<N>{});
+    }
+
+    /******************************************************************************
+     * Class: variant_storage
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This class holds the raw storage and the index of a variant.
+     *   -The index type is the smallest unsigned type able to hold every index and npos,
+     *    npos (equal to the number of alternatives) marks a variant left without value
+     *    by an exception.
+     *   -It declares no special member function, so it is trivial to copy and destroy.
+     *
+     *****************************************************************************/
+    template<typename ...Ts>
+    constexpr size_t max_sizeof()
+    {
+        constexpr size_t sizes[] = {sizeof(Ts)...};
+
+        size_t result = 0;
+        for(size_t size : sizes)
+        {
+            result = size > result ? size : result;
+        }
+        return result;
+    }
+
+    template<typename ...Ts>
+    struct variant_storage
+    {
+        static constexpr size_t npos = sizeof...(Ts);
+
+        using index_type = smallest_uint_for_t<npos>;
+
+        template<size_t I>
+        using alternative_t = at_t<type_list<Ts...> , I>;
+
+        template<size_t I>
+        alternative_t<I> *pointer() noexcept
+        {
+            return std::launder(reinterpret_cast<alternative_t<I> *>(buffer));
+        }
+
+        template<size_t I>
+        const alternative_t<I> *pointer() const noexcept
+        {
+            return std::launder(reinterpret_cast<const alternative_t<I> *>(buffer));
+        }
+
+        template<size_t I , typename ...Args>
+        void construct(Args &&...args)
+        {
+            ::new(static_cast<void *>(buffer)) alternative_t<I>(static_cast<Args &&>(args)...);
+            index = static_cast<index_type>(I);
+        }
+
+        void destroy() noexcept
+        {
+            if(index != npos)
+            {
+                visit_index<npos>(index , [this](auto i)
+                {
+                    traits::destroy_n(pointer<decltype(i)::value>() , 1);
+                });
+                index = static_cast<index_type>(npos);
+            }
+        }
+
+        template<typename Other>
+        void construct_from(Other &&other)
+        {
+            if(other.index != npos)
+            {
+                visit_index<npos>(other.index , [this , &other](auto i)
+                {
+                    using alternative = alternative_t<decltype(i)::value>;
+                    construct<decltype(i)::value>(static_cast<if_type_t<is_reference_v<Other> , const alternative & , alternative &&>>(
+                                                  *other.template pointer<decltype(i)::value>()));
+                });
+            }
+        }
+
+        alignas(Ts...) unsigned char buffer[max_sizeof<Ts...>()];
+        index_type index = static_cast<index_type>(npos);
+    };
+
+    /******************************************************************************
+     * Class: variant_destructor_base
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This class adds a destructor to the storage of a variant.
+     *   -It is specialized to keep the destructor trivial when every alternative is
+     *    trivially destructible.
+     *
+     *****************************************************************************/
+    template<bool Trivial , typename ...Ts>
+    struct variant_destructor_base : variant_storage<Ts...>{};
+
+    template<typename ...Ts>
+    struct variant_destructor_base<false , Ts...> : variant_storage<Ts...>
+    {
+        variant_destructor_base() = default;
+        variant_destructor_base(const variant_destructor_base &) = default;
+        variant_destructor_base(variant_destructor_base &&) = default;
+        variant_destructor_base &operator=(const variant_destructor_base &) = default;
+        variant_destructor_base &operator=(variant_destructor_base &&) = default;
+
+        ~variant_destructor_base()
+        {
+            this->destroy();
+        }
+    };
+
+    /******************************************************************************
+     * Class: variant_copy_base
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This class adds the copy and move operations to the storage of a variant.
+     *   -It is specialized to keep them trivial (plain byte copies) when every alternative is
+     *    trivially copyable, which makes the whole variant trivially copyable.
+     *
+     *****************************************************************************/
+    template<bool Trivial , typename ...Ts>
+    struct variant_copy_base : variant_destructor_base<conjunction_v<is_trivially_destructible<Ts>...> , Ts...>{};
+
+    template<typename ...Ts>
+    struct variant_copy_base<false , Ts...> : variant_destructor_base<conjunction_v<is_trivially_destructible<Ts>...> , Ts...>
+    {
+        variant_copy_base() = default;
+
+        variant_copy_base(const variant_copy_base &other)
+        {
+            this->construct_from(other);
+        }
+
+        variant_copy_base(variant_copy_base &&other)
+        {
+            this->construct_from(static_cast<variant_copy_base &&>(other));
+        }
+
+        variant_copy_base &operator=(const variant_copy_base &other)
+        {
+            if(this != &other)
+            {
+                this->destroy();
+                this->construct_from(other);
+            }
+            return *this;
+        }
+
+        variant_copy_base &operator=(variant_copy_base &&other)
+        {
+            if(this != &other)
+            {
+                this->destroy();
+                this->construct_from(static_cast<variant_copy_base &&>(other));
+            }
+            return *this;
+        }
+
+        ~variant_copy_base() = default;
+    };
+
+    /******************************************************************************
+     * Class: variant
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This class holds a value of one of a closed set of types.
+     *   -It is trivially destructible (trivially copyable) when all of its alternatives are.
+     *   -It is constructed and assigned from values of the exact alternative types, there is
+     *    no converting overload resolution among the alternatives.
+     *   -Access through get is unchecked, get_if and holds_alternative are the checked forms.
+     *
+     * Template Parameters:
+     *   -...Ts : The alternative types, they must be unique.
+     *
+     *****************************************************************************/
+    template<typename ...Ts>
+    class variant : private variant_copy_base<conjunction_v<is_trivially_copyable<Ts>...> , Ts...>
+    {
+        static_assert(sizeof...(Ts) > 0 , "variant needs at least one alternative");
+
+        using storage_type = variant_storage<Ts...>;
+
+        template<typename T>
+        using enable_if_alternative_t = enable_if_t<is_in_pack_v<remove_cvref_t<T> , Ts...> , int>;
+
+    public:
+        static constexpr size_t npos = storage_type::npos;
+
+        using index_type = typename storage_type::index_type;
+
+        template<size_t I>
+        using alternative_t = typename storage_type::template alternative_t<I>;
+
+        /* Description:
+         * Value-initializes the first alternative.
+         */
+        variant()
+        {
+            this->template construct<0>();
+        }
+
+        template<typename T , enable_if_alternative_t<T> = 0>
+        variant(T &&value)
+        {
+            this->template construct<type_index_of_v<remove_cvref_t<T> , Ts...>>(static_cast<T &&>(value));
+        }
+
+        template<typename T , enable_if_alternative_t<T> = 0>
+        variant &operator=(T &&value)
+        {
+            constexpr size_t I = type_index_of_v<remove_cvref_t<T> , Ts...>;
+
+            if(index() == I)
+            {
+                *this->template pointer<I>() = static_cast<T &&>(value);
+            }
+            else
+            {
+                emplace<I>(static_cast<T &&>(value));
+            }
+            return *this;
+        }
+
+        /* Description:
+         * Destroys the current value and constructs the I-th alternative in place.
+         * If the construction throws, the variant is left without value.
+         */
+        template<size_t I , typename ...Args>
+        alternative_t<I> &emplace(Args &&...args)
+        {
+            this->destroy();
+            this->template construct<I>(static_cast<Args &&>(args)...);
+            return *this->template pointer<I>();
+        }
+
+        template<typename T , typename ...Args>
+        T &emplace(Args &&...args)
+        {
+            return emplace<type_index_of_v<T , Ts...>>(static_cast<Args &&>(args)...);
+        }
+
+        size_t index() const noexcept
+        {
+            return this->storage_type::index;
+        }
+
+        bool valueless_by_exception() const noexcept
+        {
+            return index() == npos;
+        }
+
+        template<typename T>
+        bool holds_alternative() const noexcept
+        {
+            return index() == type_index_of_v<T , Ts...>;
+        }
+
+        /* Description:
+         * Unchecked access to the I-th alternative, the variant must hold it.
+         */
+        template<size_t I>
+        alternative_t<I> &get() & noexcept
+        {
+            return *this->template pointer<I>();
+        }
+
+        template<size_t I>
+        const alternative_t<I> &get() const & noexcept
+        {
+            return *this->template pointer<I>();
+        }
+
+        template<size_t I>
+        alternative_t<I> &&get() && noexcept
+        {
+            return static_cast<alternative_t<I> &&>(*this->template pointer<I>());
+        }
+    };
+
+    /******************************************************************************
+     * Metafunction: variant_size
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This metafunction returns the number of alternatives of a variant.
+     *
+     *****************************************************************************/
+    template<typename V>
+    struct variant_size;
+
+    template<typename ...Ts>
+    struct variant_size<variant<Ts...>> : integral_constant<size_t , sizeof...(Ts)>{};
+
+    template<typename V>
+    static constexpr size_t variant_size_v = variant_size<V>::value;
+
+    /******************************************************************************
+     * Function: holds_alternative, get, get_if
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -holds_alternative returns true if a variant currently holds a value of type T.
+     *   -get returns the alternative by index or by type, without checking the index.
+     *   -get_if returns a pointer to the alternative, or nullptr if it isn't the active one.
+     *
+     *****************************************************************************/
+    template<typename T , typename ...Ts>
+    bool holds_alternative(const variant<Ts...> &v) noexcept
+    {
+        return v.template holds_alternative<T>();
+    }
+
+    template<size_t I , typename ...Ts>
+    decltype(auto) get(variant<Ts...> &v) noexcept
+    {
+        return v.template get<I>();
+    }
+
+    template<size_t I , typename ...Ts>
+    decltype(auto) get(const variant<Ts...> &v) noexcept
+    {
+        return v.template get<I>();
+    }
+
+    template<size_t I , typename ...Ts>
+    decltype(auto) get(variant<Ts...> &&v) noexcept
+    {
+        return static_cast<variant<Ts...> &&>(v).template get<I>();
+    }
+
+    template<typename T , typename ...Ts>
+    decltype(auto) get(variant<Ts...> &v) noexcept
+    {
+        return v.template get<type_index_of_v<T , Ts...>>();
+    }
+
+    template<typename T , typename ...Ts>
+    decltype(auto) get(const variant<Ts...> &v) noexcept
+    {
+        return v.template get<type_index_of_v<T , Ts...>>();
+    }
+
+    template<typename T , typename ...Ts>
+    decltype(auto) get(variant<Ts...> &&v) noexcept
+    {
+        return static_cast<variant<Ts...> &&>(v).template get<type_index_of_v<T , Ts...>>();
+    }
+
+    template<size_t I , typename ...Ts>
+    auto get_if(variant<Ts...> *v) noexcept
+    {
+        return v != nullptr && v->index() == I ? &v->template get<I>() : nullptr;
+    }
+
+    template<size_t I , typename ...Ts>
+    auto get_if(const variant<Ts...> *v) noexcept
+    {
+        return v != nullptr && v->index() == I ? &v->template get<I>() : nullptr;
+    }
+
+    template<typename T , typename ...Ts>
+    auto get_if(variant<Ts...> *v) noexcept
+    {
+        return get_if<type_index_of_v<T , Ts...>>(v);
+    }
+
+    template<typename T , typename ...Ts>
+    auto get_if(const variant<Ts...> *v) noexcept
+    {
+        return get_if<type_index_of_v<T , Ts...>>(v);
+    }
+
+    /******************************************************************************
+     * Function: visit
+     *-----------------------------------------------------------------------------
+     * Description:
+     *   -This function calls f with the value currently held by a variant.
+     *   -The call goes through the jump table of visit_index, so it costs one indirect call.
+     *   -f must return the same type for every alternative, and the variant must not be
+     *    valueless.
+     *
+     *****************************************************************************/
+    template<typename F , typename V>
+    decltype(auto) visit(F &&f , V &&v)
+    {
+        return visit_index<variant_size_v<remove_cvref_t<V>>>(v.index() , [&f , &v](auto i) -> decltype(auto)
+        {
+            return static_cast<F &&>(f)(static_cast<V &&>(v).template get<decltype(i)::value>());
+        });
+    }
+
+}
+
+#endif // __VARIANT_H__